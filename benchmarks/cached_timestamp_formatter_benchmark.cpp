@@ -0,0 +1,36 @@
+// Compares the cached log timestamp formatter against rendering each
+// timestamp from scratch.
+
+#include "roo_time.h"
+#include "roo_time/cached_timestamp_formatter.h"
+#include "roo_time/date_time_format.h"
+#include "roo_time/format.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 20000000;
+  const TimeZone tz(Hours(2));
+  const WallTime base = DateTime(2024, 3, 1, tz).wallTime();
+  char buf[64];
+
+  printf("Timestamps advancing by 37 us (about 27000 per second):\n");
+  constexpr DateTimeFormat kFormat("%F %T.%3f");
+  Run("DateTimeFormat(\"%F %T.%3f\")", kIterations, [&](int64_t i) {
+    DateTime dt(base + Micros(i * 37), tz);
+    DoNotOptimize(kFormat.format(dt, buf, sizeof(buf)));
+  });
+  Rfc3339Options options;
+  options.fraction_digits = 3;
+  Run("FormatRfc3339(WallTime, TimeZone)", kIterations, [&](int64_t i) {
+    DoNotOptimize(
+        FormatRfc3339(base + Micros(i * 37), tz, buf, sizeof(buf), options));
+  });
+  CachedTimestampFormatter formatter(tz);
+  Run("CachedTimestampFormatter::format", kIterations, [&](int64_t i) {
+    DoNotOptimize(formatter.format(base + Micros(i * 37), buf, sizeof(buf)));
+  });
+  return 0;
+}
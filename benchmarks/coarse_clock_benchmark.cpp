@@ -0,0 +1,22 @@
+// Compares the cost of reading the precise and the coarse uptime.
+
+#include "roo_time.h"
+#include "roo_time/coarse_clock.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 10000000;
+
+  Run("Uptime::Now()", kIterations,
+      [](int64_t) { DoNotOptimize(Uptime::Now()); });
+  Run("Uptime::NowCoarse()", kIterations,
+      [](int64_t) { DoNotOptimize(Uptime::NowCoarse()); });
+  CoarseClock clock;
+  CoarseClockTicker ticker(clock, Millis(1));
+  Run("CoarseClock::now() (ticked every 1 ms)", kIterations,
+      [&](int64_t) { DoNotOptimize(clock.now()); });
+  return 0;
+}
@@ -0,0 +1,37 @@
+// Compares DateTimeConverter against constructing DateTime from scratch, for
+// a stream of monotonically increasing timestamps.
+
+#include "roo_time.h"
+#include "roo_time/date_time_converter.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 20000000;
+  const TimeZone tz(Hours(2));
+  const WallTime base = DateTime(2024, 3, 1, tz).wallTime();
+
+  printf("Timestamps advancing by 1 ms (same-day hit path):\n");
+  Run("DateTime(WallTime, TimeZone)", kIterations, [&](int64_t i) {
+    DateTime dt(base + Millis(i), tz);
+    DoNotOptimize(dt);
+  });
+  DateTimeConverter converter(tz);
+  Run("DateTimeConverter::convert", kIterations, [&](int64_t i) {
+    DateTime dt = converter.convert(base + Millis(i));
+    DoNotOptimize(dt);
+  });
+
+  printf("Timestamps advancing by 1 day (miss path):\n");
+  Run("DateTime(WallTime, TimeZone)", kIterations, [&](int64_t i) {
+    DateTime dt(base + Hours(24 * (i % 100000)), tz);
+    DoNotOptimize(dt);
+  });
+  Run("DateTimeConverter::convert", kIterations, [&](int64_t i) {
+    DateTime dt = converter.convert(base + Hours(24 * (i % 100000)));
+    DoNotOptimize(dt);
+  });
+  return 0;
+}
@@ -0,0 +1,31 @@
+// Compares a precompiled DateTimeFormat against strftime().
+
+#include <time.h>
+
+#include "roo_time.h"
+#include "roo_time/date_time_format.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 10000000;
+  const TimeZone tz(Hours(2));
+  const DateTime dt(2024, 7, 1, 14, 5, 9, 250000, tz);
+  char buf[64];
+
+  const char* patterns[] = {"%d.%m.%Y %H:%M", "%a, %d %b %Y %H:%M:%S %z"};
+  for (const char* pattern : patterns) {
+    printf("Pattern \"%s\":\n", pattern);
+    struct tm tm = dt.tmStruct();
+    Run("strftime", kIterations, [&](int64_t) {
+      DoNotOptimize(strftime(buf, sizeof(buf), pattern, &tm));
+    });
+    DateTimeFormat format(pattern);
+    Run("DateTimeFormat::format", kIterations, [&](int64_t) {
+      DoNotOptimize(format.format(dt, buf, sizeof(buf)));
+    });
+  }
+  return 0;
+}
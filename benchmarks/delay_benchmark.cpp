@@ -0,0 +1,78 @@
+// Reports how late DelayUntil() wakes up, as histograms, with and without
+// busy-waiting (see SetDelaySpinLimit()), along with the CPU time used.
+
+#include <stdio.h>
+#include <time.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "roo_time.h"
+
+using namespace roo_time;
+
+namespace {
+
+// Returns the CPU time used by this process so far.
+Duration CpuTime() {
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return Micros(ts.tv_sec * 1000000LL + ts.tv_nsec / 1000);
+}
+
+void Measure(const char* name, Duration spin_limit) {
+  constexpr int kDelays = 500;
+  constexpr int64_t kBuckets[] = {1,   2,   5,    10,   20,    50,
+                                  100, 200, 500, 1000, 2000, 5000};
+  constexpr int kBucketCount = sizeof(kBuckets) / sizeof(kBuckets[0]);
+  SetDelaySpinLimit(spin_limit);
+  std::vector<int64_t> lateness;
+  uint32_t state = 12345;
+  Duration cpu_start = CpuTime();
+  Uptime start = Uptime::Now();
+  for (int i = 0; i < kDelays; ++i) {
+    state = state * 1664525 + 1013904223;
+    // Between 0.2 and 2.2 ms.
+    Uptime deadline = Uptime::Now() + Micros(200 + (state >> 8) % 2000);
+    DelayUntil(deadline);
+    lateness.push_back((Uptime::Now() - deadline).inMicros());
+  }
+  Duration elapsed = Uptime::Now() - start;
+  Duration cpu = CpuTime() - cpu_start;
+  SetDelaySpinLimit(Duration());
+
+  std::sort(lateness.begin(), lateness.end());
+  printf("%s: %d delays\n", name, kDelays);
+  printf("  lateness (us): min %lld, p50 %lld, p90 %lld, p99 %lld, max %lld\n",
+         (long long)lateness.front(), (long long)lateness[kDelays / 2],
+         (long long)lateness[kDelays * 9 / 10],
+         (long long)lateness[kDelays * 99 / 100], (long long)lateness.back());
+  printf("  CPU: %.1f%% of %lld ms\n", 100.0 * cpu.inMicros() / elapsed.inMicros(),
+         (long long)elapsed.inMillis());
+  int counts[kBucketCount + 1] = {0};
+  for (int64_t l : lateness) {
+    int b = 0;
+    while (b < kBucketCount && l >= kBuckets[b]) ++b;
+    ++counts[b];
+  }
+  for (int b = 0; b <= kBucketCount; ++b) {
+    if (b < kBucketCount) {
+      printf("  < %5lld us: ", (long long)kBuckets[b]);
+    } else {
+      printf("  >=%5lld us: ", (long long)kBuckets[kBucketCount - 1]);
+    }
+    printf("%4d ", counts[b]);
+    for (int i = 0; i < counts[b] * 60 / kDelays; ++i) printf("#");
+    printf("\n");
+  }
+}
+
+}  // namespace
+
+int main() {
+  Measure("Sleep", Duration());
+  Measure("Sleep + spin (limit 1 ms)", Millis(1));
+  printf("Estimated sleep overshoot: %lld us\n",
+         (long long)DelayOvershootEstimate().inMicros());
+  return 0;
+}
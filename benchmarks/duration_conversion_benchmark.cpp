@@ -0,0 +1,65 @@
+// Compares the division operator against multiplication by a reciprocal, for
+// converting microsecond counts to coarser units.
+//
+// On 64-bit hosts, the compiler already strength-reduces division by a
+// constant, so the first two rows are expected to be close; the last row
+// emulates the reciprocal method as compiled for 32-bit targets. The
+// difference that matters is on 32-bit targets, where the division operator
+// compiles to a runtime library call (build this benchmark for the target to
+// see it).
+
+#include <random>
+#include <vector>
+
+#include "roo_time.h"
+#include "roo_time/internal/divide.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+using namespace roo_time::internal;
+
+namespace {
+
+// As div_by_reciprocal(), but with the 32-bit multiplication.
+template <uint64_t kDivisor>
+int64_t DivByReciprocal32(int64_t n) {
+  using R = Reciprocal<kDivisor>;
+  uint64_t u = (n < 0) ? 0 - (uint64_t)n : (uint64_t)n;
+  uint64_t q = mulhi64_32(u >> R::kPreShift, R::kMagic) >> R::kPostShift;
+  return (n < 0) ? -(int64_t)q : (int64_t)q;
+}
+
+// Prevents the compiler from treating the divisor as a constant.
+volatile int64_t divisor = 1000000;
+
+}  // namespace
+
+int main() {
+  constexpr int64_t kIterations = 20000000;
+  constexpr size_t kCount = 4096;
+  std::vector<int64_t> inputs;
+  std::mt19937_64 gen(42);
+  for (size_t i = 0; i < kCount; ++i) {
+    inputs.push_back((int64_t)gen() >> (gen() % 40));
+  }
+  const int64_t d = divisor;
+
+  printf("Microseconds to seconds:\n");
+  Run("n / d (runtime divisor)", kIterations, [&](int64_t i) {
+    DoNotOptimize(inputs[i % kCount] / d);
+  });
+  Run("n / 1000000", kIterations, [&](int64_t i) {
+    DoNotOptimize(inputs[i % kCount] / 1000000);
+  });
+  Run("div_by_reciprocal<1000000>", kIterations, [&](int64_t i) {
+    DoNotOptimize(div_by_reciprocal<1000000>(inputs[i % kCount]));
+  });
+  Run("div_by_reciprocal<1000000>, 32-bit mulhi", kIterations, [&](int64_t i) {
+    DoNotOptimize(DivByReciprocal32<1000000>(inputs[i % kCount]));
+  });
+  Run("Duration::inSecondsRoundedNearest", kIterations, [&](int64_t i) {
+    DoNotOptimize(Micros(inputs[i % kCount]).inSecondsRoundedNearest());
+  });
+  return 0;
+}
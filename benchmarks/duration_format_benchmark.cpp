@@ -0,0 +1,58 @@
+// Measures parsing and formatting of human-readable durations, as found in
+// configuration files, e.g. "250ms" or "1h30m".
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "roo_time.h"
+#include "roo_time/duration_format.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 10000000;
+  constexpr size_t kCount = 4096;
+
+  // Typical timeouts and periods: mostly whole milliseconds to hours.
+  std::vector<Duration> durations;
+  std::vector<std::string> inputs;
+  uint32_t state = 12345;
+  for (size_t i = 0; i < kCount; ++i) {
+    state = state * 1664525 + 1013904223;
+    Duration d;
+    switch ((state >> 8) % 4) {
+      case 0:
+        d = Millis(state % 1000);
+        break;
+      case 1:
+        d = Millis(state % 60000);
+        break;
+      case 2:
+        d = Seconds(state % 3600);
+        break;
+      default:
+        d = Minutes(state % 1440);
+        break;
+    }
+    durations.push_back(d);
+    char buf[kDurationBufferSize];
+    FormatDuration(d, buf, sizeof(buf));
+    inputs.push_back(buf);
+  }
+
+  Run("ParseDuration", kIterations, [&](int64_t i) {
+    const std::string& s = inputs[i % kCount];
+    Duration d;
+    DoNotOptimize(ParseDuration(s.data(), s.size(), &d));
+    DoNotOptimize(d);
+  });
+  char buf[kDurationBufferSize];
+  Run("FormatDuration", kIterations, [&](int64_t i) {
+    DoNotOptimize(FormatDuration(durations[i % kCount], buf, sizeof(buf)));
+  });
+  return 0;
+}
@@ -0,0 +1,64 @@
+// Compares RFC 3339 formatting against strftime() and the DateTime stream
+// operator.
+
+#include <string.h>
+#include <time.h>
+
+#include <sstream>
+
+#include "roo_time.h"
+#include "roo_time/format.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 5000000;
+  const TimeZone tz(Hours(2));
+  const WallTime base = DateTime(2024, 3, 1, tz).wallTime();
+  char buf[64];
+
+  printf("Timestamps advancing by 1.234567 ms, with microseconds:\n");
+  Run("strftime + snprintf", kIterations, [&](int64_t i) {
+    WallTime t = base + Micros(i * 1234567 / 1000);
+    int64_t micros = (t.sinceEpoch() + tz.offset()).inMicros();
+    time_t seconds = micros / 1000000;
+    struct tm tm;
+    gmtime_r(&seconds, &tm);
+    size_t len = strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tm);
+    snprintf(buf + len, sizeof(buf) - len, ".%06d+02:00",
+             (int)(micros % 1000000));
+    DoNotOptimize(buf[0]);
+  });
+  std::ostringstream os;
+  Run("operator<<(ostream&, DateTime)", kIterations, [&](int64_t i) {
+    os.str("");
+    os << DateTime(base + Micros(i * 1234567 / 1000), tz);
+    DoNotOptimize(os.tellp());
+  });
+  Rfc3339Options options;
+  options.fraction_digits = 6;
+  Run("FormatRfc3339(DateTime)", kIterations, [&](int64_t i) {
+    DateTime dt(base + Micros(i * 1234567 / 1000), tz);
+    DoNotOptimize(FormatRfc3339(dt, buf, sizeof(buf), options));
+  });
+  Run("FormatRfc3339(WallTime, TimeZone)", kIterations, [&](int64_t i) {
+    DoNotOptimize(FormatRfc3339(base + Micros(i * 1234567 / 1000), tz, buf,
+                                sizeof(buf), options));
+  });
+
+  constexpr size_t kBatch = 1024;
+  static WallTime times[kBatch];
+  static char out[kBatch * kRfc3339BufferSize];
+  for (size_t i = 0; i < kBatch; ++i) {
+    times[i] = base + Micros(i * 1234567 / 1000);
+  }
+  Run("FormatRfc3339 (bulk, 1024 timestamps)", kIterations / kBatch,
+      [&](int64_t) {
+        DoNotOptimize(FormatRfc3339(times, kBatch, tz, out, kRfc3339BufferSize,
+                                    options));
+      });
+  printf("  (divide by %d for per-timestamp cost)\n", (int)kBatch);
+  return 0;
+}
@@ -0,0 +1,39 @@
+// Compares the cost of "construct, then read a single field" between the
+// eagerly computed DateTime and LazyDateTime.
+
+#include "roo_time.h"
+#include "roo_time/lazy_date_time.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 20000000;
+  const TimeZone tz(Hours(-5));
+  const WallTime base(Micros(1700000000000000LL));
+
+  Run("DateTime + hour()", kIterations, [&](int64_t i) {
+    DoNotOptimize(DateTime(base + Seconds(i * 17), tz).hour());
+  });
+  Run("LazyDateTime + hour()", kIterations, [&](int64_t i) {
+    DoNotOptimize(LazyDateTime(base + Seconds(i * 17), tz).hour());
+  });
+  Run("DateTime + dayOfWeek()", kIterations, [&](int64_t i) {
+    DoNotOptimize(DateTime(base + Seconds(i * 17), tz).dayOfWeek());
+  });
+  Run("LazyDateTime + dayOfWeek()", kIterations, [&](int64_t i) {
+    DoNotOptimize(LazyDateTime(base + Seconds(i * 17), tz).dayOfWeek());
+  });
+  Run("DateTime + all fields", kIterations, [&](int64_t i) {
+    DateTime dt(base + Seconds(i * 17), tz);
+    DoNotOptimize(dt.year() + dt.month() + dt.day() + dt.hour() +
+                  dt.minute() + dt.second() + dt.dayOfWeek());
+  });
+  Run("LazyDateTime + all fields", kIterations, [&](int64_t i) {
+    LazyDateTime dt(base + Seconds(i * 17), tz);
+    DoNotOptimize(dt.year() + dt.month() + dt.day() + dt.hour() +
+                  dt.minute() + dt.second() + dt.dayOfWeek());
+  });
+  return 0;
+}
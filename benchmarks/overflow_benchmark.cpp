@@ -0,0 +1,34 @@
+// Compares plain and saturating deadline arithmetic.
+
+#include "roo_time.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 20000000;
+  const Uptime now = Uptime::Now();
+
+  Run("Uptime + Duration", kIterations, [&](int64_t i) {
+    DoNotOptimize(now + Micros(i));
+  });
+  Run("SaturatingAdd(Uptime, Duration)", kIterations, [&](int64_t i) {
+    DoNotOptimize(SaturatingAdd(now, Micros(i)));
+  });
+  Run("SaturatingAdd(Uptime, Duration::Max())", kIterations, [&](int64_t i) {
+    DoNotOptimize(SaturatingAdd(now + Micros(i), Duration::Max()));
+  });
+  Run("CheckedAdd(Uptime, Duration)", kIterations, [&](int64_t i) {
+    Uptime deadline;
+    DoNotOptimize(CheckedAdd(now, Micros(i), &deadline));
+    DoNotOptimize(deadline);
+  });
+  Run("Duration * int", kIterations, [&](int64_t i) {
+    DoNotOptimize(Millis(i) * 1000);
+  });
+  Run("SaturatingMul(Duration, int)", kIterations, [&](int64_t i) {
+    DoNotOptimize(SaturatingMul(Millis(i), 1000));
+  });
+  return 0;
+}
@@ -0,0 +1,66 @@
+// Measures RFC 3339 parsing throughput, compared to strptime() + timegm().
+
+#define _GNU_SOURCE 1
+
+#include <string.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include "roo_time.h"
+#include "roo_time/format.h"
+#include "roo_time/parse.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 10000000;
+  constexpr size_t kCount = 4096;
+
+  // Timestamps as found in telemetry: millisecond precision, various offsets.
+  std::vector<std::string> inputs;
+  size_t total_length = 0;
+  uint32_t state = 12345;
+  for (size_t i = 0; i < kCount; ++i) {
+    state = state * 1664525 + 1013904223;
+    WallTime t(Seconds(1700000000 + (state >> 4)) + Millis(state % 1000));
+    TimeZone tz(Minutes(60 * ((int)(state % 25) - 12)));
+    Rfc3339Options options;
+    options.fraction_digits = 3;
+    char buf[kRfc3339BufferSize];
+    FormatRfc3339(t, tz, buf, sizeof(buf), options);
+    inputs.push_back(buf);
+    total_length += inputs.back().size();
+  }
+  double average_length = (double)total_length / kCount;
+
+  double ns = Run("strptime + timegm (no fraction, no offset)", kIterations,
+                  [&](int64_t i) {
+                    const std::string& s = inputs[i % kCount];
+                    struct tm tm;
+                    memset(&tm, 0, sizeof(tm));
+                    strptime(s.c_str(), "%Y-%m-%dT%H:%M:%S", &tm);
+                    DoNotOptimize(timegm(&tm));
+                  });
+  printf("  %.0f MB/s\n", average_length * 1000.0 / ns);
+
+  ns = Run("ParseRfc3339 -> WallTime", kIterations, [&](int64_t i) {
+    const std::string& s = inputs[i % kCount];
+    WallTime t;
+    DoNotOptimize(ParseRfc3339(s.data(), s.size(), &t));
+    DoNotOptimize(t);
+  });
+  printf("  %.0f MB/s\n", average_length * 1000.0 / ns);
+
+  ns = Run("ParseRfc3339 -> DateTime", kIterations, [&](int64_t i) {
+    const std::string& s = inputs[i % kCount];
+    DateTime dt;
+    DoNotOptimize(ParseRfc3339(s.data(), s.size(), &dt));
+    DoNotOptimize(dt);
+  });
+  printf("  %.0f MB/s\n", average_length * 1000.0 / ns);
+  return 0;
+}
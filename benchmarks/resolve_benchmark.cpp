@@ -0,0 +1,41 @@
+// Measures conversion of local civil times (e.g. user-entered alarm times) to
+// wall time, in zones with daylight saving time.
+
+#include "roo_time.h"
+#include "roo_time/posix_tz.h"
+#include "roo_time/resolve.h"
+#include "roo_time/tzdb/zones.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+namespace {
+
+void Resolve(const char* name, const TimeZoneRules& zone) {
+  constexpr int64_t kIterations = 10000000;
+  // Local times spread over 2024, at 1-minute granularity.
+  uint32_t state = 12345;
+  double ns = Run(name, kIterations, [&](int64_t) {
+    state = state * 1664525 + 1013904223;
+    uint32_t minutes = (state >> 8) % (365 * 24 * 60);
+    DateTime local =
+        DateTime(2024, 1, 1, timezone::UTC).plus(Minutes(minutes));
+    WallTime t;
+    DoNotOptimize(WallTimeFromLocal(local.year(), local.month(), local.day(),
+                                    local.hour(), local.minute(), 0, 0, zone,
+                                    LocalTimePolicy::kEarliest, &t));
+    DoNotOptimize(t);
+  });
+  printf("  %.1f M conversions/s\n", 1000.0 / ns);
+}
+
+}  // namespace
+
+int main() {
+  Resolve("tzdb Europe/Warsaw", tzdb::Europe_Warsaw);
+  PosixTimeZone zone;
+  zone.parse("CET-1CEST,M3.5.0,M10.5.0/3");
+  Resolve("POSIX CET-1CEST,M3.5.0,M10.5.0/3", zone);
+  return 0;
+}
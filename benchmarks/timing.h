@@ -0,0 +1,32 @@
+#pragma once
+
+// Minimal timing harness shared by the benchmark binaries.
+
+#include <stdio.h>
+
+#include "roo_time.h"
+
+namespace roo_time {
+namespace benchmark {
+
+// Prevents the compiler from optimizing away the computation of `value`.
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+  asm volatile("" : : "r"(&value) : "memory");
+}
+
+// Runs `fn(i)` for i in [0, iterations), and prints the average time per
+// call. Returns that average, in nanoseconds.
+template <typename Fn>
+double Run(const char* name, int64_t iterations, Fn&& fn) {
+  for (int64_t i = 0; i < iterations / 10; ++i) fn(i);
+  Uptime start = Uptime::Now();
+  for (int64_t i = 0; i < iterations; ++i) fn(i);
+  Duration elapsed = Uptime::Now() - start;
+  double ns = elapsed.inMicros() * 1000.0 / iterations;
+  printf("%-48s %10.2f ns/op\n", name, ns);
+  return ns;
+}
+
+}  // namespace benchmark
+}  // namespace roo_time
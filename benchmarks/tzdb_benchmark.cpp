@@ -0,0 +1,32 @@
+// Measures UTC offset lookups in the compiled-in time zone tables.
+
+#include "roo_time.h"
+#include "roo_time/tzdb.h"
+#include "roo_time/tzdb/zones.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+namespace {
+
+void Lookups(const char* name, const TzdbTimeZone& zone) {
+  constexpr int64_t kIterations = 20000000;
+  // Pseudo-random instants spread over 1970-2037.
+  uint32_t state = 12345;
+  double ns = Run(name, kIterations, [&](int64_t) {
+    state = state * 1664525 + 1013904223;
+    WallTime t(Seconds((int64_t)(state >> 1)));
+    DoNotOptimize(zone.timeZoneAt(t));
+  });
+  printf("  %.1f M lookups/s\n", 1000.0 / ns);
+}
+
+}  // namespace
+
+int main() {
+  Lookups("Europe/Warsaw", tzdb::Europe_Warsaw);
+  Lookups("America/New_York", tzdb::America_New_York);
+  Lookups("Asia/Tokyo", tzdb::Asia_Tokyo);
+  return 0;
+}
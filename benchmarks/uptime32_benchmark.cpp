@@ -0,0 +1,46 @@
+// Compares scanning a table of timeouts stored as Uptime (8 bytes) and as
+// Uptime32 (4 bytes).
+
+#include <vector>
+
+#include "roo_time.h"
+#include "roo_time/uptime32.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 50;
+  // Larger than typical last-level caches, so that scans are memory-bound.
+  constexpr size_t kCount = 1 << 23;
+
+  // Deadlines within an hour of now, close to a wrap-around of Uptime32.
+  const Uptime now = Uptime::Start() + Millis((1LL << 32) * 3 - 600000);
+  std::vector<Uptime> deadlines;
+  std::vector<Uptime32> deadlines32;
+  uint32_t state = 12345;
+  for (size_t i = 0; i < kCount; ++i) {
+    state = state * 1664525 + 1013904223;
+    Uptime deadline = now + Millis((int32_t)(state % 3600000) - 1800000);
+    deadlines.push_back(deadline);
+    deadlines32.push_back(Uptime32(deadline));
+  }
+  printf("Counting expired deadlines among %zu:\n", kCount);
+  printf("  Uptime:   %zu KiB\n", sizeof(Uptime) * kCount / 1024);
+  printf("  Uptime32: %zu KiB\n", sizeof(Uptime32) * kCount / 1024);
+
+  Run("Uptime (per table scan)", kIterations, [&](int64_t i) {
+    Uptime t = now + Millis(i);
+    size_t expired = 0;
+    for (const Uptime& deadline : deadlines) expired += (deadline <= t);
+    DoNotOptimize(expired);
+  });
+  Run("Uptime32 (per table scan)", kIterations, [&](int64_t i) {
+    Uptime32 t(now + Millis(i));
+    size_t expired = 0;
+    for (const Uptime32& deadline : deadlines32) expired += (deadline <= t);
+    DoNotOptimize(expired);
+  });
+  return 0;
+}
@@ -0,0 +1,38 @@
+// Measures the cost of reading the current uptime, against the underlying
+// clocks.
+
+#include <time.h>
+
+#include <chrono>
+
+#include "roo_time.h"
+#include "roo_time/internal/tsc_clock.h"
+#include "timing.h"
+
+using namespace roo_time;
+using namespace roo_time::benchmark;
+
+int main() {
+  constexpr int64_t kIterations = 10000000;
+
+  Run("Uptime::Now()", kIterations,
+      [](int64_t) { DoNotOptimize(Uptime::Now()); });
+  Run("clock_gettime(CLOCK_MONOTONIC)", kIterations, [](int64_t) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    DoNotOptimize(ts);
+  });
+  Run("std::chrono::steady_clock::now()", kIterations,
+      [](int64_t) { DoNotOptimize(std::chrono::steady_clock::now()); });
+  Run("std::chrono::system_clock::now()", kIterations,
+      [](int64_t) { DoNotOptimize(std::chrono::system_clock::now()); });
+#ifdef ROO_TIME_TSC_CLOCK_AVAILABLE
+  static internal::TscClock tsc_clock;
+  // Completes the initial calibration.
+  Uptime calibrated = Uptime::Now() + Millis(20);
+  while (Uptime::Now() < calibrated) tsc_clock.now();
+  Run("TscClock::now()", kIterations,
+      [](int64_t) { DoNotOptimize(tsc_clock.now()); });
+#endif
+  return 0;
+}
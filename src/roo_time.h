@@ -5,6 +5,10 @@
 /// Provides duration, uptime, and wall-time abstractions.
 
 #include <inttypes.h>
+
+#include "roo_time/internal/calendar.h"
+#include "roo_time/internal/divide.h"
+#include "roo_time/internal/overflow.h"
 #if defined(ESP_PLATFORM) || defined(__linux__)
 #define CTIME_HDR_DEFINED
 #include <sys/time.h>
@@ -38,7 +42,7 @@ class Duration {
   constexpr Duration() : micros_(0) {}
 
   /// Returns the maximum representable duration.
-  static const Duration Max() { return Duration(0x7FFFFFFFFFFFFFFF); }
+  static constexpr Duration Max() { return Duration(0x7FFFFFFFFFFFFFFF); }
 
   /// Returns duration in microseconds.
   [[nodiscard]] constexpr int64_t inMicros() const { return micros_; }
@@ -63,52 +67,52 @@ class Duration {
 
   /// Returns duration in milliseconds, rounded toward zero.
   [[nodiscard]] constexpr int64_t inMillisRoundedDown() const {
-    return micros_ / 1000LL;
+    return internal::div_toward_zero<1000ULL>(micros_);
   }
 
   /// Returns duration in seconds, rounded toward zero.
   [[nodiscard]] constexpr int64_t inSecondsRoundedDown() const {
-    return micros_ / 1000000LL;
+    return internal::div_toward_zero<1000000ULL>(micros_);
   }
 
   /// Returns duration in minutes, rounded toward zero.
   [[nodiscard]] constexpr int64_t inMinutesRoundedDown() const {
-    return micros_ / 60000000LL;
+    return internal::div_toward_zero<60000000ULL>(micros_);
   }
 
   /// Returns duration in hours, rounded toward zero.
   [[nodiscard]] constexpr int64_t inHoursRoundedDown() const {
-    return micros_ / 3600000000LL;
+    return internal::div_toward_zero<3600000000ULL>(micros_);
   }
 
   /// Returns duration in milliseconds, rounded away from zero.
   [[nodiscard]] constexpr int64_t inMillisRoundedUp() const {
-    int64_t q = micros_ / 1000LL;
-    int64_t r = micros_ % 1000LL;
+    int64_t q = internal::div_toward_zero<1000ULL>(micros_);
+    int64_t r = micros_ - q * 1000LL;
     if (r == 0) return q;
     return micros_ > 0 ? q + 1 : q - 1;
   }
 
   /// Returns duration in seconds, rounded away from zero.
   [[nodiscard]] constexpr int64_t inSecondsRoundedUp() const {
-    int64_t q = micros_ / 1000000LL;
-    int64_t r = micros_ % 1000000LL;
+    int64_t q = internal::div_toward_zero<1000000ULL>(micros_);
+    int64_t r = micros_ - q * 1000000LL;
     if (r == 0) return q;
     return micros_ > 0 ? q + 1 : q - 1;
   }
 
   /// Returns duration in minutes, rounded away from zero.
   [[nodiscard]] constexpr int64_t inMinutesRoundedUp() const {
-    int64_t q = micros_ / 60000000LL;
-    int64_t r = micros_ % 60000000LL;
+    int64_t q = internal::div_toward_zero<60000000ULL>(micros_);
+    int64_t r = micros_ - q * 60000000LL;
     if (r == 0) return q;
     return micros_ > 0 ? q + 1 : q - 1;
   }
 
   /// Returns duration in hours, rounded away from zero.
   [[nodiscard]] constexpr int64_t inHoursRoundedUp() const {
-    int64_t q = micros_ / 3600000000LL;
-    int64_t r = micros_ % 3600000000LL;
+    int64_t q = internal::div_toward_zero<3600000000ULL>(micros_);
+    int64_t r = micros_ - q * 3600000000LL;
     if (r == 0) return q;
     return micros_ > 0 ? q + 1 : q - 1;
   }
@@ -116,8 +120,8 @@ class Duration {
   /// Returns duration in milliseconds, rounded to nearest (ties away from
   /// zero).
   [[nodiscard]] constexpr int64_t inMillisRoundedNearest() const {
-    int64_t q = micros_ / 1000LL;
-    int64_t r = micros_ % 1000LL;
+    int64_t q = internal::div_toward_zero<1000ULL>(micros_);
+    int64_t r = micros_ - q * 1000LL;
     int64_t ar = r < 0 ? -r : r;
     if (ar * 2 < 1000LL) return q;
     return micros_ > 0 ? q + 1 : q - 1;
@@ -125,8 +129,8 @@ class Duration {
 
   /// Returns duration in seconds, rounded to nearest (ties away from zero).
   [[nodiscard]] constexpr int64_t inSecondsRoundedNearest() const {
-    int64_t q = micros_ / 1000000LL;
-    int64_t r = micros_ % 1000000LL;
+    int64_t q = internal::div_toward_zero<1000000ULL>(micros_);
+    int64_t r = micros_ - q * 1000000LL;
     int64_t ar = r < 0 ? -r : r;
     if (ar * 2 < 1000000LL) return q;
     return micros_ > 0 ? q + 1 : q - 1;
@@ -134,8 +138,8 @@ class Duration {
 
   /// Returns duration in minutes, rounded to nearest (ties away from zero).
   [[nodiscard]] constexpr int64_t inMinutesRoundedNearest() const {
-    int64_t q = micros_ / 60000000LL;
-    int64_t r = micros_ % 60000000LL;
+    int64_t q = internal::div_toward_zero<60000000ULL>(micros_);
+    int64_t r = micros_ - q * 60000000LL;
     int64_t ar = r < 0 ? -r : r;
     if (ar * 2 < 60000000LL) return q;
     return micros_ > 0 ? q + 1 : q - 1;
@@ -143,8 +147,8 @@ class Duration {
 
   /// Returns duration in hours, rounded to nearest (ties away from zero).
   [[nodiscard]] constexpr int64_t inHoursRoundedNearest() const {
-    int64_t q = micros_ / 3600000000LL;
-    int64_t r = micros_ % 3600000000LL;
+    int64_t q = internal::div_toward_zero<3600000000ULL>(micros_);
+    int64_t r = micros_ - q * 3600000000LL;
     int64_t ar = r < 0 ? -r : r;
     if (ar * 2 < 3600000000LL) return q;
     return micros_ > 0 ? q + 1 : q - 1;
@@ -169,14 +173,14 @@ class Duration {
   }
 
   /// Adds another duration to this one.
-  Duration& operator+=(const Duration& other) {
-    micros_ += other.inMicros();
+  constexpr Duration& operator+=(const Duration& other) {
+    micros_ = internal::add_micros(micros_, other.inMicros());
     return *this;
   }
 
   /// Subtracts another duration from this one.
-  Duration& operator-=(const Duration& other) {
-    micros_ -= other.inMicros();
+  constexpr Duration& operator-=(const Duration& other) {
+    micros_ = internal::sub_micros(micros_, other.inMicros());
     return *this;
   }
 
@@ -388,53 +392,105 @@ inline constexpr Duration Hours(double hours) {
 }
 
 /// Returns true if both durations are equal.
-inline bool operator==(const Duration& a, const Duration& b) {
+inline constexpr bool operator==(const Duration& a, const Duration& b) {
   return a.inMicros() == b.inMicros();
 }
 
 /// Returns true if durations differ.
-inline bool operator!=(const Duration& a, const Duration& b) {
+inline constexpr bool operator!=(const Duration& a, const Duration& b) {
   return a.inMicros() != b.inMicros();
 }
 
 /// Returns true if `a` is shorter than `b`.
-inline bool operator<(const Duration& a, const Duration& b) {
+inline constexpr bool operator<(const Duration& a, const Duration& b) {
   return a.inMicros() < b.inMicros();
 }
 
 /// Returns true if `a` is longer than `b`.
-inline bool operator>(const Duration& a, const Duration& b) {
+inline constexpr bool operator>(const Duration& a, const Duration& b) {
   return a.inMicros() > b.inMicros();
 }
 
 /// Returns true if `a` is not longer than `b`.
-inline bool operator<=(const Duration& a, const Duration& b) {
+inline constexpr bool operator<=(const Duration& a, const Duration& b) {
   return a.inMicros() <= b.inMicros();
 }
 
 /// Returns true if `a` is not shorter than `b`.
-inline bool operator>=(const Duration& a, const Duration& b) {
+inline constexpr bool operator>=(const Duration& a, const Duration& b) {
   return a.inMicros() >= b.inMicros();
 }
 
 /// Returns the sum of two durations.
-inline Duration operator+(const Duration& a, const Duration& b) {
-  return Micros(a.inMicros() + b.inMicros());
+inline constexpr Duration operator+(const Duration& a, const Duration& b) {
+  return Micros(internal::add_micros(a.inMicros(), b.inMicros()));
 }
 
 /// Returns the difference between two durations.
-inline Duration operator-(const Duration& a, const Duration& b) {
-  return Micros(a.inMicros() - b.inMicros());
+inline constexpr Duration operator-(const Duration& a, const Duration& b) {
+  return Micros(internal::sub_micros(a.inMicros(), b.inMicros()));
 }
 
 /// Multiplies duration by an integer factor.
-inline Duration operator*(const Duration& a, int b) {
-  return Micros(a.inMicros() * b);
+inline constexpr Duration operator*(const Duration& a, int b) {
+  return Micros(internal::mul_micros(a.inMicros(), b));
 }
 
 /// Multiplies duration by an integer factor.
-inline Duration operator*(int a, const Duration& b) {
-  return Micros(a * b.inMicros());
+inline constexpr Duration operator*(int a, const Duration& b) {
+  return Micros(internal::mul_micros(a, b.inMicros()));
+}
+
+/// Returns `a + b`, clamped to the range of `Duration`. In particular, adding
+/// anything to `Duration::Max()` yields `Duration::Max()`.
+///
+/// (Plain `operator+` wraps around on overflow.)
+inline constexpr Duration SaturatingAdd(Duration a, Duration b) {
+  return Micros(internal::saturating_add(a.inMicros(), b.inMicros()));
+}
+
+/// Returns `a - b`, clamped to the range of `Duration`.
+inline constexpr Duration SaturatingSub(Duration a, Duration b) {
+  return Micros(internal::saturating_sub(a.inMicros(), b.inMicros()));
+}
+
+/// Returns `a * b`, clamped to the range of `Duration`.
+inline constexpr Duration SaturatingMul(Duration a, int64_t b) {
+  return Micros(internal::saturating_mul(a.inMicros(), b));
+}
+
+/// Computes `a + b` into `result`. Returns false, leaving `result`
+/// unmodified, if the sum is not representable.
+[[nodiscard]] inline constexpr bool CheckedAdd(Duration a, Duration b,
+                                               Duration* result) {
+  int64_t micros = 0;
+  if (__builtin_add_overflow(a.inMicros(), b.inMicros(), &micros)) {
+    return false;
+  }
+  *result = Micros(micros);
+  return true;
+}
+
+/// Computes `a - b` into `result`. Returns false, leaving `result`
+/// unmodified, if the difference is not representable.
+[[nodiscard]] inline constexpr bool CheckedSub(Duration a, Duration b,
+                                               Duration* result) {
+  int64_t micros = 0;
+  if (__builtin_sub_overflow(a.inMicros(), b.inMicros(), &micros)) {
+    return false;
+  }
+  *result = Micros(micros);
+  return true;
+}
+
+/// Computes `a * b` into `result`. Returns false, leaving `result`
+/// unmodified, if the product is not representable.
+[[nodiscard]] inline constexpr bool CheckedMul(Duration a, int64_t b,
+                                               Duration* result) {
+  int64_t micros = 0;
+  if (__builtin_mul_overflow(a.inMicros(), b, &micros)) return false;
+  *result = Micros(micros);
+  return true;
 }
 
 /// Represents an instant relative to process/boot start time.
@@ -446,23 +502,34 @@ class Uptime {
   /// Returns current monotonic process uptime.
   static const Uptime Now();
 
+  /// Returns the current uptime at reduced resolution, more cheaply than
+  /// `Now()`. Intended for hot paths that only need coarse (e.g. millisecond)
+  /// timeouts.
+  ///
+  /// On Linux, reads `CLOCK_MONOTONIC_COARSE`, which is updated by the
+  /// scheduler tick, and lags `Now()` by up to about two ticks (a tick is
+  /// typically 1-4 ms; see `clock_getres()`). Elsewhere, same as `Now()`.
+  /// Never decreases, but may appear earlier than a preceding `Now()`. See
+  /// also `CoarseClock` in `roo_time/coarse_clock.h`.
+  static const Uptime NowCoarse();
+
   /// Returns uptime value at process start.
-  static const Uptime Start() { return Uptime(0); }
+  static constexpr Uptime Start() { return Uptime(0); }
 
   /// Returns the maximum representable uptime value.
-  static const Uptime Max() { return Uptime(0x7FFFFFFFFFFFFFFF); }
+  static constexpr Uptime Max() { return Uptime(0x7FFFFFFFFFFFFFFF); }
 
   /// Constructs zero uptime value.
-  Uptime() : micros_(0) {}
+  constexpr Uptime() : micros_(0) {}
 
   /// Copy constructor.
-  Uptime(const Uptime& other) : micros_(other.micros_) {}
+  constexpr Uptime(const Uptime& other) : micros_(other.micros_) {}
 
   /// Copy constructor for volatile sources.
   Uptime(const volatile Uptime& other) : micros_(other.micros_) {}
 
   /// Assignment operator.
-  Uptime& operator=(const Uptime& other) {
+  constexpr Uptime& operator=(const Uptime& other) {
     micros_ = other.micros_;
     return *this;
   }
@@ -474,94 +541,141 @@ class Uptime {
   }
 
   /// Returns uptime in microseconds.
-  [[nodiscard]] int64_t inMicros() const { return micros_; }
+  [[nodiscard]] constexpr int64_t inMicros() const { return micros_; }
 
   /// Returns uptime in milliseconds.
-  [[nodiscard]] int64_t inMillis() const { return micros_ / 1000LL; }
+  [[nodiscard]] constexpr int64_t inMillis() const {
+    return internal::div_toward_zero<1000ULL>(micros_);
+  }
 
   /// Returns uptime in seconds.
-  [[nodiscard]] int64_t inSeconds() const { return micros_ / 1000000LL; }
+  [[nodiscard]] constexpr int64_t inSeconds() const {
+    return internal::div_toward_zero<1000000ULL>(micros_);
+  }
 
   /// Returns uptime in minutes.
-  [[nodiscard]] int64_t inMinutes() const { return micros_ / 60000000LL; }
+  [[nodiscard]] constexpr int64_t inMinutes() const {
+    return internal::div_toward_zero<60000000ULL>(micros_);
+  }
 
   /// Returns uptime in hours.
-  [[nodiscard]] int64_t inHours() const { return micros_ / 3600000000LL; }
+  [[nodiscard]] constexpr int64_t inHours() const {
+    return internal::div_toward_zero<3600000000ULL>(micros_);
+  }
 
   // Duration HowLongAgo() const {
   //   return Duration(Now().ToMicros() - this->ToMicros);
   // }
 
   /// Adds duration to this uptime.
-  Uptime& operator+=(const Duration& i) {
-    micros_ += i.inMicros();
+  constexpr Uptime& operator+=(const Duration& i) {
+    micros_ = internal::add_micros(micros_, i.inMicros());
     return *this;
   }
 
   /// Subtracts duration from this uptime.
-  Uptime& operator-=(const Duration& i) {
-    micros_ -= i.inMicros();
+  constexpr Uptime& operator-=(const Duration& i) {
+    micros_ = internal::sub_micros(micros_, i.inMicros());
     return *this;
   }
 
  private:
-  friend Uptime operator+(const Uptime& u, const Duration& i);
-  friend Uptime operator-(const Uptime& u, const Duration& i);
-  friend Uptime operator+(const Duration& i, const Uptime& u);
+  friend constexpr Uptime operator+(const Uptime& u, const Duration& i);
+  friend constexpr Uptime operator-(const Uptime& u, const Duration& i);
+  friend constexpr Uptime operator+(const Duration& i, const Uptime& u);
 
-  Uptime(int64_t micros) : micros_(micros) {}
+  constexpr Uptime(int64_t micros) : micros_(micros) {}
 
   int64_t micros_;
 };
 
 /// Returns true if uptimes are equal.
-inline bool operator==(const Uptime& a, const Uptime& b) {
+inline constexpr bool operator==(const Uptime& a, const Uptime& b) {
   return a.inMicros() == b.inMicros();
 }
 
 /// Returns true if uptimes differ.
-inline bool operator!=(const Uptime& a, const Uptime& b) {
+inline constexpr bool operator!=(const Uptime& a, const Uptime& b) {
   return a.inMicros() != b.inMicros();
 }
 
 /// Returns true if `a` is earlier than `b`.
-inline bool operator<(const Uptime& a, const Uptime& b) {
+inline constexpr bool operator<(const Uptime& a, const Uptime& b) {
   return a.inMicros() < b.inMicros();
 }
 
 /// Returns true if `a` is later than `b`.
-inline bool operator>(const Uptime& a, const Uptime& b) {
+inline constexpr bool operator>(const Uptime& a, const Uptime& b) {
   return a.inMicros() > b.inMicros();
 }
 
 /// Returns true if `a` is not later than `b`.
-inline bool operator<=(const Uptime& a, const Uptime& b) {
+inline constexpr bool operator<=(const Uptime& a, const Uptime& b) {
   return a.inMicros() <= b.inMicros();
 }
 
 /// Returns true if `a` is not earlier than `b`.
-inline bool operator>=(const Uptime& a, const Uptime& b) {
+inline constexpr bool operator>=(const Uptime& a, const Uptime& b) {
   return a.inMicros() >= b.inMicros();
 }
 
 /// Returns elapsed duration between two uptime instants.
-inline Duration operator-(const Uptime& a, const Uptime& b) {
-  return Micros(a.inMicros() - b.inMicros());
+inline constexpr Duration operator-(const Uptime& a, const Uptime& b) {
+  return Micros(internal::sub_micros(a.inMicros(), b.inMicros()));
 }
 
 /// Returns uptime shifted by duration.
-inline Uptime operator+(const Uptime& u, const Duration& i) {
-  return Uptime(u.inMicros() + i.inMicros());
+inline constexpr Uptime operator+(const Uptime& u, const Duration& i) {
+  return Uptime(internal::add_micros(u.inMicros(), i.inMicros()));
 }
 
 /// Returns uptime shifted backwards by duration.
-inline Uptime operator-(const Uptime& u, const Duration& i) {
-  return Uptime(u.inMicros() - i.inMicros());
+inline constexpr Uptime operator-(const Uptime& u, const Duration& i) {
+  return Uptime(internal::sub_micros(u.inMicros(), i.inMicros()));
 }
 
 /// Returns uptime shifted by duration.
-inline Uptime operator+(const Duration& i, const Uptime& u) {
-  return Uptime(u.inMicros() + i.inMicros());
+inline constexpr Uptime operator+(const Duration& i, const Uptime& u) {
+  return Uptime(internal::add_micros(u.inMicros(), i.inMicros()));
+}
+
+/// Returns uptime shifted by duration, clamped to the range of `Uptime`. Use
+/// to compute deadlines from arbitrary timeouts: e.g.
+/// `SaturatingAdd(Uptime::Now(), Duration::Max())` is `Uptime::Max()`.
+inline constexpr Uptime SaturatingAdd(Uptime u, Duration d) {
+  return Uptime::Start() +
+         Micros(internal::saturating_add(u.inMicros(), d.inMicros()));
+}
+
+/// Returns uptime shifted backwards by duration, clamped to the range of
+/// `Uptime`.
+inline constexpr Uptime SaturatingSub(Uptime u, Duration d) {
+  return Uptime::Start() +
+         Micros(internal::saturating_sub(u.inMicros(), d.inMicros()));
+}
+
+/// Computes `u + d` into `result`. Returns false, leaving `result`
+/// unmodified, if the sum is not representable.
+[[nodiscard]] inline constexpr bool CheckedAdd(Uptime u, Duration d,
+                                               Uptime* result) {
+  int64_t micros = 0;
+  if (__builtin_add_overflow(u.inMicros(), d.inMicros(), &micros)) {
+    return false;
+  }
+  *result = Uptime::Start() + Micros(micros);
+  return true;
+}
+
+/// Computes `u - d` into `result`. Returns false, leaving `result`
+/// unmodified, if the difference is not representable.
+[[nodiscard]] inline constexpr bool CheckedSub(Uptime u, Duration d,
+                                               Uptime* result) {
+  int64_t micros = 0;
+  if (__builtin_sub_overflow(u.inMicros(), d.inMicros(), &micros)) {
+    return false;
+  }
+  *result = Uptime::Start() + Micros(micros);
+  return true;
 }
 
 /// Delays execution for `duration`.
@@ -574,6 +688,52 @@ void Delay(Duration duration);
 /// If deadline is in the past, returns immediately.
 void DelayUntil(Uptime deadline);
 
+/// Sets the maximum time that `Delay()` and `DelayUntil()` may busy-wait, in
+/// order to wake up on time. Trades CPU for precision.
+///
+/// Sleeping alone wakes up late, by the scheduler's latency: up to a tick
+/// (1-10 ms) on FreeRTOS, and tens of microseconds on Linux. With a non-zero
+/// limit, delays sleep until shortly before the deadline, and busy-wait the
+/// rest. How long before is calibrated automatically from the observed
+/// wake-ups (see `DelayOvershootEstimate()`), and capped at `limit`. Delays
+/// then never return before the deadline, and typically return within a
+/// microsecond or so after it.
+///
+/// Zero (the default) disables busy-waiting. Applies to all threads.
+void SetDelaySpinLimit(Duration limit);
+
+/// Returns the limit set by `SetDelaySpinLimit()`.
+[[nodiscard]] Duration DelaySpinLimit();
+
+/// Returns the current estimate of how late sleeps wake up, as calibrated by
+/// delays with a non-zero spin limit.
+[[nodiscard]] Duration DelayOvershootEstimate();
+
+/// Abstract source of uptime and delays, which can replace the platform clock
+/// at runtime (see `SetUptimeSource()`), e.g. to simulate time in tests. See
+/// `VirtualClock` in `roo_time/virtual_clock.h`.
+class UptimeSource {
+ public:
+  /// Virtual destructor.
+  virtual ~UptimeSource() = default;
+
+  /// Returns the current uptime. Must never decrease.
+  virtual Uptime now() const = 0;
+
+  /// Blocks the calling thread until `deadline`. If deadline is in the past,
+  /// returns immediately.
+  virtual void delayUntil(Uptime deadline) = 0;
+};
+
+/// Makes `Uptime::Now()`, `Uptime::NowCoarse()`, `Delay()`, and
+/// `DelayUntil()` use `source`, or the platform clock if `source` is nullptr.
+/// Returns the previously installed source (nullptr if none).
+///
+/// The source must remain alive while installed, and until calls that
+/// started using it return. Costs an atomic load and a well-predicted branch
+/// in `Uptime::Now()`.
+UptimeSource* SetUptimeSource(UptimeSource* source);
+
 /// Represents absolute wall time since Unix epoch.
 ///
 /// Stored with microsecond precision and 64-bit range. Does not account for
@@ -581,84 +741,116 @@ void DelayUntil(Uptime deadline);
 class WallTime {
  public:
   /// Constructs epoch wall time.
-  WallTime() {}
+  constexpr WallTime() {}
 
   /// Constructs wall time from offset since Unix epoch.
-  explicit WallTime(Duration since_epoch) : since_epoch_(since_epoch) {}
+  constexpr explicit WallTime(Duration since_epoch)
+      : since_epoch_(since_epoch) {}
 
   /// Returns elapsed duration since Unix epoch.
-  [[nodiscard]] Duration sinceEpoch() const { return since_epoch_; }
+  [[nodiscard]] constexpr Duration sinceEpoch() const { return since_epoch_; }
 
   /// Adds duration to this wall time.
-  WallTime& operator+=(const Duration& i) {
+  constexpr WallTime& operator+=(const Duration& i) {
     since_epoch_ += i;
     return *this;
   }
 
   /// Subtracts duration from this wall time.
-  WallTime& operator-=(const Duration& i) {
+  constexpr WallTime& operator-=(const Duration& i) {
     since_epoch_ -= i;
     return *this;
   }
 
  private:
-  friend WallTime operator+(const WallTime&, const Duration&);
-  friend WallTime operator-(const WallTime&, const Duration&);
-  friend WallTime operator+(const Duration&, const WallTime&);
+  friend constexpr WallTime operator+(const WallTime&, const Duration&);
+  friend constexpr WallTime operator-(const WallTime&, const Duration&);
+  friend constexpr WallTime operator+(const Duration&, const WallTime&);
 
   Duration since_epoch_;
 };
 
 /// Returns true if both wall times are equal.
-inline bool operator==(const WallTime& a, const WallTime& b) {
+inline constexpr bool operator==(const WallTime& a, const WallTime& b) {
   return a.sinceEpoch() == b.sinceEpoch();
 }
 
 /// Returns true if wall times differ.
-inline bool operator!=(const WallTime& a, const WallTime& b) {
+inline constexpr bool operator!=(const WallTime& a, const WallTime& b) {
   return a.sinceEpoch() != b.sinceEpoch();
 }
 
 /// Returns true if `a` is earlier than `b`.
-inline bool operator<(const WallTime& a, const WallTime& b) {
+inline constexpr bool operator<(const WallTime& a, const WallTime& b) {
   return a.sinceEpoch() < b.sinceEpoch();
 }
 
 /// Returns true if `a` is later than `b`.
-inline bool operator>(const WallTime& a, const WallTime& b) {
+inline constexpr bool operator>(const WallTime& a, const WallTime& b) {
   return a.sinceEpoch() > b.sinceEpoch();
 }
 
 /// Returns true if `a` is not later than `b`.
-inline bool operator<=(const WallTime& a, const WallTime& b) {
+inline constexpr bool operator<=(const WallTime& a, const WallTime& b) {
   return a.sinceEpoch() <= b.sinceEpoch();
 }
 
 /// Returns true if `a` is not earlier than `b`.
-inline bool operator>=(const WallTime& a, const WallTime& b) {
+inline constexpr bool operator>=(const WallTime& a, const WallTime& b) {
   return a.sinceEpoch() >= b.sinceEpoch();
 }
 
 /// Returns elapsed duration between two wall times.
-inline Duration operator-(const WallTime& a, const WallTime& b) {
+inline constexpr Duration operator-(const WallTime& a, const WallTime& b) {
   return a.sinceEpoch() - b.sinceEpoch();
 }
 
 /// Returns wall time shifted by duration.
-inline WallTime operator+(const WallTime& t, const Duration& i) {
+inline constexpr WallTime operator+(const WallTime& t, const Duration& i) {
   return WallTime(t.sinceEpoch() + i);
 }
 
 /// Returns wall time shifted backwards by duration.
-inline WallTime operator-(const WallTime& t, const Duration& i) {
+inline constexpr WallTime operator-(const WallTime& t, const Duration& i) {
   return WallTime(t.sinceEpoch() - i);
 }
 
 /// Returns wall time shifted by duration.
-inline WallTime operator+(const Duration& i, const WallTime& t) {
+inline constexpr WallTime operator+(const Duration& i, const WallTime& t) {
   return WallTime(t.sinceEpoch() + i);
 }
 
+/// Returns wall time shifted by duration, clamped to the range of `WallTime`.
+inline constexpr WallTime SaturatingAdd(WallTime t, Duration d) {
+  return WallTime(SaturatingAdd(t.sinceEpoch(), d));
+}
+
+/// Returns wall time shifted backwards by duration, clamped to the range of
+/// `WallTime`.
+inline constexpr WallTime SaturatingSub(WallTime t, Duration d) {
+  return WallTime(SaturatingSub(t.sinceEpoch(), d));
+}
+
+/// Computes `t + d` into `result`. Returns false, leaving `result`
+/// unmodified, if the sum is not representable.
+[[nodiscard]] inline constexpr bool CheckedAdd(WallTime t, Duration d,
+                                               WallTime* result) {
+  Duration since_epoch;
+  if (!CheckedAdd(t.sinceEpoch(), d, &since_epoch)) return false;
+  *result = WallTime(since_epoch);
+  return true;
+}
+
+/// Computes `t - d` into `result`. Returns false, leaving `result`
+/// unmodified, if the difference is not representable.
+[[nodiscard]] inline constexpr bool CheckedSub(WallTime t, Duration d,
+                                               WallTime* result) {
+  Duration since_epoch;
+  if (!CheckedSub(t.sinceEpoch(), d, &since_epoch)) return false;
+  *result = WallTime(since_epoch);
+  return true;
+}
+
 /// Abstract interface for obtaining current wall time.
 class WallTimeClock {
  public:
@@ -685,7 +877,7 @@ class SystemClock : public WallTimeClock {
 class TimeZone {
  public:
   /// Constructs UTC timezone.
-  TimeZone() : offset_minutes_(0) {}
+  constexpr TimeZone() : offset_minutes_(0) {}
 
   /// Creates time zone with specified UTC offset.
   constexpr explicit TimeZone(Duration offset)
@@ -704,6 +896,30 @@ namespace timezone {
 constexpr TimeZone UTC = TimeZone(Micros(0));
 }
 
+/// Abstract interface of time zones whose UTC offset varies over time (e.g.
+/// due to daylight saving time).
+///
+/// Implementations are typically defined as constants, or have static
+/// lifetime, so the destructor is not virtual.
+class TimeZoneRules {
+ public:
+  /// Returns the fixed-offset time zone in effect at instant `t`.
+  virtual TimeZone timeZoneAt(WallTime t) const = 0;
+
+  /// Finds the first instant `t` in (`lo`, `hi`] at which the UTC offset
+  /// changes, i.e. `timeZoneAt(t)` differs from `timeZoneAt(t - Micros(1))`.
+  /// Returns false (leaving `transition` unchanged) if there is none.
+  ///
+  /// The default implementation bisects the interval with `timeZoneAt()`,
+  /// assuming at most one transition in it (up to ~40 lookups for two days).
+  /// Implementations should override it with a direct lookup.
+  virtual bool transitionBetween(WallTime lo, WallTime hi,
+                                 WallTime* transition) const;
+
+ protected:
+  ~TimeZoneRules() = default;
+};
+
 enum DayOfWeek {
   kSunday = 0,
   kMonday = 1,
@@ -729,20 +945,58 @@ enum Month {
   kDecember = 12
 };
 
+/// Returns the wall time at which the civil time in time zone `tz` has the
+/// specified components. Performs no validation.
+///
+/// Usable in constant expressions, e.g. to place schedule tables in flash:
+///
+/// ```cpp
+/// constexpr WallTime kSchedule[] = {
+///     WallTimeFromCivil(2024, 3, 31, 2, 0, 0, 0, TimeZone(Hours(1))),
+///     WallTimeFromCivil(2024, 10, 27, 3, 0, 0, 0, TimeZone(Hours(2))),
+/// };
+/// ```
+///
+/// @param year Year.
+/// @param month Month in [1, 12].
+/// @param day Day in [1, max_day_of_month].
+/// @param hour Hour in [0, 23].
+/// @param minute Minute in [0, 59].
+/// @param second Second in [0, 59].
+/// @param micros Microsecond fraction in [0, 999999].
+/// @param tz Time zone to interpret the components in.
+inline constexpr WallTime WallTimeFromCivil(int16_t year, uint8_t month,
+                                            uint8_t day, uint8_t hour,
+                                            uint8_t minute, uint8_t second,
+                                            uint32_t micros, TimeZone tz) {
+  int64_t t = internal::days_from_civil(year, month, day);
+  t = ((((t * 24) + hour) * 60 + minute) * 60 + second) * 1000000 + micros;
+  return WallTime(Micros(t) - tz.offset());
+}
+
+/// Returns the wall time of midnight of the specified date in time zone `tz`.
+/// Usable in constant expressions.
+inline constexpr WallTime WallTimeFromCivil(int16_t year, uint8_t month,
+                                            uint8_t day, TimeZone tz) {
+  return WallTimeFromCivil(year, month, day, 0, 0, 0, 0, tz);
+}
+
 /// Represents wall time decomposed into date/time in a specific time zone.
 ///
-/// Does not account for leap seconds.
+/// Does not account for leap seconds. All constructors and calendar
+/// arithmetic are constexpr.
 class DateTime {
  public:
   /// Constructs `DateTime` representing current time in UTC.
-  DateTime() : DateTime(WallTime(), timezone::UTC) {}
+  constexpr DateTime() : DateTime(WallTime(), timezone::UTC) {}
 
   /// Constructs `DateTime` at midnight of a date in the specified time zone.
   ///
   /// @param year Four-digit year.
   /// @param month Month in [1, 12].
   /// @param day Day in [1, max_day_of_month].
-  DateTime(uint16_t year, uint8_t month, uint8_t day, TimeZone tz);
+  constexpr DateTime(uint16_t year, uint8_t month, uint8_t day, TimeZone tz)
+      : DateTime(year, month, day, 0, 0, 0, 0, tz) {}
 
   /// Constructs date/time in the specified time zone.
   ///
@@ -754,44 +1008,145 @@ class DateTime {
   /// @param second Second in [0, 59].
   /// @param micros Microsecond fraction in [0, 999999].
   /// @param tz Time zone to interpret the components in.
-  DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
-           uint8_t minute, uint8_t second, uint32_t micros, TimeZone tz);
+  constexpr DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
+                     uint8_t minute, uint8_t second, uint32_t micros,
+                     TimeZone tz)
+      : walltime_(WallTimeFromCivil(year, month, day, hour, minute, second,
+                                    micros, tz)),
+        tz_(tz),
+        year_(year),
+        month_(month),
+        day_(day),
+        hour_(hour),
+        minute_(minute),
+        second_(second),
+        day_of_week_(static_cast<DayOfWeek>(internal::weekday_from_days(
+            internal::days_from_civil(year, month, day)))),
+        day_of_year_(internal::day_of_year(year, month, day)),
+        micros_(micros) {}
 
   /// Constructs `DateTime` for `wallTime` in time zone `tz`.
-  DateTime(WallTime wallTime, TimeZone tz);
+  constexpr DateTime(WallTime wallTime, TimeZone tz)
+      : walltime_(wallTime), tz_(tz) {
+    int64_t local = (wallTime.sinceEpoch() + tz.offset()).inMicros();
+    int32_t unix_days = internal::floor_div<int64_t>(local, kMicrosPerDay);
+    internal::civil_from_days(unix_days, &year_, &month_, &day_);
+    day_of_year_ = internal::day_of_year(year_, month_, day_);
+    day_of_week_ =
+        static_cast<DayOfWeek>(internal::weekday_from_days(unix_days));
+    uint64_t since_midnight = local - unix_days * kMicrosPerDay;
+    micros_ = since_midnight % 1000000L;
+    since_midnight /= 1000000L;
+    second_ = since_midnight % 60;
+    since_midnight /= 60;
+    minute_ = since_midnight % 60;
+    since_midnight /= 60;
+    hour_ = since_midnight;
+  }
+
+  /// Constructs `DateTime` for `wallTime` in the time zone determined by
+  /// `rules` at that instant.
+  DateTime(WallTime wallTime, const TimeZoneRules& rules)
+      : DateTime(wallTime, rules.timeZoneAt(wallTime)) {}
 
   /// Returns `WallTime` corresponding to this `DateTime`.
-  [[nodiscard]] WallTime wallTime() const { return walltime_; }
+  [[nodiscard]] constexpr WallTime wallTime() const { return walltime_; }
 
   /// Returns time zone of this `DateTime`.
-  [[nodiscard]] TimeZone timeZone() const { return tz_; }
+  [[nodiscard]] constexpr TimeZone timeZone() const { return tz_; }
 
   /// Returns four-digit year.
-  [[nodiscard]] int16_t year() const { return year_; }
+  [[nodiscard]] constexpr int16_t year() const { return year_; }
 
   /// Returns month in [1, 12].
-  [[nodiscard]] Month month() const { return (Month)month_; }
+  [[nodiscard]] constexpr Month month() const { return (Month)month_; }
 
   /// Returns day of month in valid range.
-  [[nodiscard]] uint8_t day() const { return day_; }
+  [[nodiscard]] constexpr uint8_t day() const { return day_; }
 
   /// Returns hour in [0, 23].
-  [[nodiscard]] uint8_t hour() const { return hour_; }
+  [[nodiscard]] constexpr uint8_t hour() const { return hour_; }
 
   /// Returns minute in [0, 59].
-  [[nodiscard]] uint8_t minute() const { return minute_; }
+  [[nodiscard]] constexpr uint8_t minute() const { return minute_; }
 
   /// Returns second in [0, 59].
-  [[nodiscard]] uint8_t second() const { return second_; }
+  [[nodiscard]] constexpr uint8_t second() const { return second_; }
 
   /// Returns microsecond fraction in [0, 999999].
-  [[nodiscard]] uint32_t micros() const { return micros_; }
+  [[nodiscard]] constexpr uint32_t micros() const { return micros_; }
 
   /// Returns day of week in this time zone.
-  [[nodiscard]] DayOfWeek dayOfWeek() const { return day_of_week_; }
+  [[nodiscard]] constexpr DayOfWeek dayOfWeek() const { return day_of_week_; }
 
   /// Returns day of year in [1, 366].
-  [[nodiscard]] uint16_t dayOfYear() const { return day_of_year_; }
+  [[nodiscard]] constexpr uint16_t dayOfYear() const { return day_of_year_; }
+
+  /// Returns this date/time shifted by `duration`, in the same time zone.
+  ///
+  /// Equivalent to `DateTime(wallTime() + duration, timeZone())`, but only
+  /// recomputes the time-of-day fields if the result falls on the same day.
+  [[nodiscard]] constexpr DateTime plus(Duration duration) const {
+    int64_t since_midnight =
+        (((hour_ * 60LL) + minute_) * 60 + second_) * 1000000 + micros_ +
+        duration.inMicros();
+    if (since_midnight < 0 || since_midnight >= kMicrosPerDay) {
+      return DateTime(walltime_ + duration, tz_);
+    }
+    uint32_t seconds = since_midnight / 1000000;
+    return DateTime(walltime_ + duration, tz_, year_, month_, day_,
+                    seconds / 3600, (seconds / 60) % 60, seconds % 60,
+                    since_midnight % 1000000, day_of_week_, day_of_year_);
+  }
+
+  /// Returns this date/time shifted by `days` calendar days (which may be
+  /// negative), keeping the time of day.
+  [[nodiscard]] constexpr DateTime plusDays(int32_t days) const {
+    WallTime walltime = walltime_ + Hours(24LL * days);
+    DayOfWeek dow = ShiftDayOfWeek(day_of_week_, days);
+    int32_t day = day_ + days;
+    if (day >= 1 && day <= internal::last_day_of_month(year_, month_)) {
+      // Same month; only the day fields change.
+      return DateTime(walltime, tz_, year_, month_, day, hour_, minute_,
+                      second_, micros_, dow, day_of_year_ + days);
+    }
+    int16_t year = 0;
+    uint8_t month = 0;
+    uint8_t mday = 0;
+    internal::civil_from_days(
+        internal::days_from_civil(year_, month_, day_) + days, &year, &month,
+        &mday);
+    return DateTime(walltime, tz_, year, month, mday, hour_, minute_, second_,
+                    micros_, dow, internal::day_of_year(year, month, mday));
+  }
+
+  /// Returns this date/time shifted by `months` calendar months (which may be
+  /// negative), keeping the time of day.
+  ///
+  /// If the day of month does not exist in the target month, it is clamped to
+  /// the last day of that month (e.g. Jan 31 + 1 month = Feb 28 or 29).
+  [[nodiscard]] constexpr DateTime plusMonths(int32_t months) const {
+    int32_t total = year_ * 12 + (month_ - 1) + months;
+    int16_t year = internal::floor_div<int32_t>(total, 12);
+    uint8_t month = internal::floor_mod<int32_t>(total, 12) + 1;
+    uint8_t day = day_;
+    uint8_t last = internal::last_day_of_month(year, month);
+    if (day > last) day = last;
+    int32_t days = internal::days_from_civil(year, month, day) -
+                   internal::days_from_civil(year_, month_, day_);
+    return DateTime(walltime_ + Hours(24LL * days), tz_, year, month, day,
+                    hour_, minute_, second_, micros_,
+                    ShiftDayOfWeek(day_of_week_, days),
+                    internal::day_of_year(year, month, day));
+  }
+
+  /// Returns this date/time shifted by `years` calendar years (which may be
+  /// negative), keeping the time of day.
+  ///
+  /// February 29 is clamped to February 28 in non-leap years.
+  [[nodiscard]] constexpr DateTime plusYears(int32_t years) const {
+    return plusMonths(years * 12);
+  }
 
 #ifdef CTIME_HDR_DEFINED
   /// Constructs `DateTime` from C `tm` structure.
@@ -814,27 +1169,52 @@ class DateTime {
 #endif
 
  private:
+  friend class DateTimeConverter;
+
+  static constexpr int64_t kMicrosPerDay = 24LL * 3600 * 1000000;
+
+  static constexpr DayOfWeek ShiftDayOfWeek(DayOfWeek dow, int32_t days) {
+    return static_cast<DayOfWeek>(
+        internal::floor_mod<int32_t>(dow + days % 7, 7));
+  }
+
+  // Constructs `DateTime` from already-computed fields, without validation.
+  constexpr DateTime(WallTime wall_time, TimeZone tz, int16_t year, uint8_t month,
+           uint8_t day, uint8_t hour, uint8_t minute, uint8_t second,
+           uint32_t micros, DayOfWeek day_of_week, uint16_t day_of_year)
+      : walltime_(wall_time),
+        tz_(tz),
+        year_(year),
+        month_(month),
+        day_(day),
+        hour_(hour),
+        minute_(minute),
+        second_(second),
+        day_of_week_(day_of_week),
+        day_of_year_(day_of_year),
+        micros_(micros) {}
+
   WallTime walltime_;
   TimeZone tz_;
-  int16_t year_;
-  uint8_t month_;
-  uint8_t day_;
-  uint8_t hour_;
-  uint8_t minute_;
-  uint8_t second_;
-  DayOfWeek day_of_week_;
-  uint16_t day_of_year_;
-  uint32_t micros_;
+  int16_t year_ = 0;
+  uint8_t month_ = 0;
+  uint8_t day_ = 0;
+  uint8_t hour_ = 0;
+  uint8_t minute_ = 0;
+  uint8_t second_ = 0;
+  DayOfWeek day_of_week_ = kSunday;
+  uint16_t day_of_year_ = 0;
+  uint32_t micros_ = 0;
 };
 
 /// Returns true if both date-times represent the same instant and offset.
-inline bool operator==(const DateTime& a, const DateTime& b) {
+inline constexpr bool operator==(const DateTime& a, const DateTime& b) {
   return a.wallTime() == b.wallTime() &&
          a.timeZone().offset() == b.timeZone().offset();
 }
 
 /// Returns true if date-times differ in instant or time-zone offset.
-inline bool operator!=(const DateTime& a, const DateTime& b) {
+inline constexpr bool operator!=(const DateTime& a, const DateTime& b) {
   return a.wallTime() != b.wallTime() ||
          a.timeZone().offset() != b.timeZone().offset();
 }
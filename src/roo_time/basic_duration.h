@@ -0,0 +1,705 @@
+#pragma once
+
+/// Durations and time points with a configurable storage type and resolution.
+///
+/// `Duration`, `Uptime`, and `WallTime` store 64-bit microsecond counts. The
+/// templates in this header store a count of type `Rep` with a tick length of
+/// `Period` seconds (a `std::ratio`), e.g. 64-bit nanoseconds for high-rate
+/// sampling, or 32-bit milliseconds for large timer tables:
+///
+/// ```
+/// NanosDuration period(2500);               // 2.5us.
+/// NanosDuration timeout = Millis(20);         // Implicit; exact.
+/// MillisDuration32 coarse(period + timeout);  // Explicit; truncates.
+/// ```
+///
+/// Conversions between resolutions use conversion factors computed at compile
+/// time, so they fold to a single multiplication or division (or a shift).
+/// Conversions that cannot lose information (to a finer resolution that is
+/// an integer multiple, and to a storage type that is at least as wide) are
+/// implicit; others are explicit, and truncate toward zero. Overflow is not
+/// checked.
+///
+/// `Duration`, `Uptime`, and `WallTime` interoperate with the
+/// `BasicDuration<int64_t, std::micro>` instantiations (`MicrosDuration`,
+/// `MicrosUptime`, and `MicrosWallTime`), converting to and from them
+/// implicitly, and follow the same conversion rules for other instantiations.
+/// Arithmetic and comparisons on mixed types are carried out at the finest
+/// common resolution.
+
+#include <inttypes.h>
+
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+template <typename Rep, typename Period>
+class BasicDuration;
+
+/// Tag for time points measured since device start, like `Uptime`.
+struct UptimeTag {};
+
+/// Tag for time points measured since the Unix epoch, like `WallTime`.
+struct WallTimeTag {};
+
+template <typename Tag, typename Rep, typename Period>
+class BasicTimePoint;
+
+namespace internal {
+
+constexpr intmax_t gcd(intmax_t a, intmax_t b) {
+  return b == 0 ? a : gcd(b, a % b);
+}
+
+// Returns true if every value of FromRep is representable as ToRep. As in
+// std::chrono, floating-point destinations are treated as lossless.
+template <typename FromRep, typename ToRep>
+constexpr bool IsLosslessRep() {
+  if (std::is_floating_point<ToRep>::value) return true;
+  if (std::is_floating_point<FromRep>::value) return false;
+  if (std::is_signed<FromRep>::value != std::is_signed<ToRep>::value) {
+    return !std::is_signed<FromRep>::value && sizeof(ToRep) > sizeof(FromRep);
+  }
+  return sizeof(ToRep) >= sizeof(FromRep);
+}
+
+// Returns true if a duration with the given rep and period converts to the
+// other one without loss.
+template <typename FromRep, typename FromPeriod, typename ToRep,
+          typename ToPeriod>
+constexpr bool IsLosslessDuration() {
+  return IsLosslessRep<FromRep, ToRep>() &&
+         (std::is_floating_point<ToRep>::value ||
+          std::ratio_divide<FromPeriod, ToPeriod>::den == 1);
+}
+
+// Converts a tick count between periods, truncating toward zero.
+template <typename ToRep, typename FromPeriod, typename ToPeriod,
+          typename FromRep>
+constexpr ToRep ConvertCount(FromRep count) {
+  using Factor = std::ratio_divide<FromPeriod, ToPeriod>;
+  using Wide = std::common_type_t<ToRep, FromRep, intmax_t>;
+  if (Factor::num == 1 && Factor::den == 1) {
+    return static_cast<ToRep>(count);
+  }
+  if (Factor::den == 1) {
+    return static_cast<ToRep>(static_cast<Wide>(count) *
+                              static_cast<Wide>(Factor::num));
+  }
+  if (Factor::num == 1) {
+    return static_cast<ToRep>(static_cast<Wide>(count) /
+                              static_cast<Wide>(Factor::den));
+  }
+  return static_cast<ToRep>(static_cast<Wide>(count) *
+                            static_cast<Wide>(Factor::num) /
+                            static_cast<Wide>(Factor::den));
+}
+
+// Maps duration types (BasicDuration, and Duration) to the corresponding
+// BasicDuration. Has no `type` for other types.
+template <typename T>
+struct AsBasicDuration {};
+
+template <typename Rep, typename Period>
+struct AsBasicDuration<BasicDuration<Rep, Period>> {
+  using type = BasicDuration<Rep, Period>;
+  static constexpr type Convert(type d) { return d; }
+};
+
+template <>
+struct AsBasicDuration<Duration> {
+  using type = BasicDuration<int64_t, std::micro>;
+  static constexpr type Convert(Duration d);
+};
+
+template <typename D1, typename D2>
+struct CommonBasicDuration;
+
+template <typename Rep1, typename Period1, typename Rep2, typename Period2>
+struct CommonBasicDuration<BasicDuration<Rep1, Period1>,
+                           BasicDuration<Rep2, Period2>> {
+  using type = BasicDuration<
+      std::common_type_t<Rep1, Rep2>,
+      std::ratio<gcd(Period1::num, Period2::num),
+                 Period1::den / gcd(Period1::den, Period2::den) *
+                     Period2::den>>;
+};
+
+template <typename T>
+struct IsBasicDuration : std::false_type {};
+
+template <typename Rep, typename Period>
+struct IsBasicDuration<BasicDuration<Rep, Period>> : std::true_type {};
+
+// The common BasicDuration of duration types A and B, at least one of which
+// is a BasicDuration. Substitution fails otherwise, so that the mixed-type
+// operators below do not apply to (Duration, Duration).
+template <typename A, typename B>
+using CommonDurationT = std::enable_if_t<
+    IsBasicDuration<A>::value || IsBasicDuration<B>::value,
+    typename CommonBasicDuration<typename AsBasicDuration<A>::type,
+                                 typename AsBasicDuration<B>::type>::type>;
+
+// R, if A and B are duration types, at least one of which is a
+// BasicDuration. Substitution fails otherwise.
+template <typename A, typename B, typename R>
+using IfDurations = std::conditional_t<true, R, CommonDurationT<A, B>>;
+
+// Converts a duration of type A to the common type C.
+template <typename C, typename A>
+constexpr C ToCommon(const A& d) {
+  return C(AsBasicDuration<A>::Convert(d));
+}
+
+// Legacy (microsecond) time point types, and conversions to and from their
+// offsets in microseconds.
+template <typename Tag>
+struct TimePointTraits;
+
+template <>
+struct TimePointTraits<UptimeTag> {
+  using Legacy = Uptime;
+  static constexpr int64_t ToMicros(Uptime t) { return t.inMicros(); }
+  static constexpr Uptime FromMicros(int64_t micros) {
+    return Uptime::Start() + Micros(micros);
+  }
+};
+
+template <>
+struct TimePointTraits<WallTimeTag> {
+  using Legacy = WallTime;
+  static constexpr int64_t ToMicros(WallTime t) {
+    return t.sinceEpoch().inMicros();
+  }
+  static constexpr WallTime FromMicros(int64_t micros) {
+    return WallTime(Micros(micros));
+  }
+};
+
+// Maps time point types (BasicTimePoint, Uptime, and WallTime) to the
+// corresponding BasicTimePoint. Has no `type` for other types.
+template <typename T>
+struct AsBasicTimePoint {};
+
+template <typename Tag, typename Rep, typename Period>
+struct AsBasicTimePoint<BasicTimePoint<Tag, Rep, Period>> {
+  using type = BasicTimePoint<Tag, Rep, Period>;
+  static constexpr type Convert(type t) { return t; }
+};
+
+template <>
+struct AsBasicTimePoint<Uptime> {
+  using type = BasicTimePoint<UptimeTag, int64_t, std::micro>;
+  static constexpr type Convert(Uptime t);
+};
+
+template <>
+struct AsBasicTimePoint<WallTime> {
+  using type = BasicTimePoint<WallTimeTag, int64_t, std::micro>;
+  static constexpr type Convert(WallTime t);
+};
+
+template <typename T>
+struct IsBasicTimePoint : std::false_type {};
+
+template <typename Tag, typename Rep, typename Period>
+struct IsBasicTimePoint<BasicTimePoint<Tag, Rep, Period>> : std::true_type {};
+
+template <typename T1, typename T2>
+struct CommonBasicTimePoint {};
+
+template <typename Tag, typename Rep1, typename Period1, typename Rep2,
+          typename Period2>
+struct CommonBasicTimePoint<BasicTimePoint<Tag, Rep1, Period1>,
+                            BasicTimePoint<Tag, Rep2, Period2>> {
+  using duration = typename CommonBasicDuration<
+      BasicDuration<Rep1, Period1>, BasicDuration<Rep2, Period2>>::type;
+  using type = BasicTimePoint<Tag, typename duration::rep,
+                              typename duration::period>;
+};
+
+// The common BasicTimePoint of time point types A and B, which must measure
+// time since the same origin, and at least one of which is a BasicTimePoint.
+template <typename A, typename B>
+using CommonTimePointT = std::enable_if_t<
+    IsBasicTimePoint<A>::value || IsBasicTimePoint<B>::value,
+    typename CommonBasicTimePoint<typename AsBasicTimePoint<A>::type,
+                                  typename AsBasicTimePoint<B>::type>::type>;
+
+// R, if A and B are time point types with the same origin, at least one of
+// which is a BasicTimePoint. Substitution fails otherwise.
+template <typename A, typename B, typename R>
+using IfTimePoints = std::conditional_t<true, R, CommonTimePointT<A, B>>;
+
+// Converts a time point of type A to the common type C.
+template <typename C, typename A>
+constexpr C ToCommonTimePoint(const A& t) {
+  return C(AsBasicTimePoint<A>::Convert(t));
+}
+
+// The time point type T, shifted by a duration of type D.
+template <typename T, typename D>
+using ShiftedTimePointT = std::enable_if_t<
+    IsBasicTimePoint<T>::value || IsBasicDuration<D>::value,
+    BasicTimePoint<
+        typename AsBasicTimePoint<T>::type::tag,
+        typename CommonBasicDuration<
+            typename AsBasicTimePoint<T>::type::duration,
+            typename AsBasicDuration<D>::type>::type::rep,
+        typename CommonBasicDuration<
+            typename AsBasicTimePoint<T>::type::duration,
+            typename AsBasicDuration<D>::type>::type::period>>;
+
+}  // namespace internal
+
+/// An amount of time, stored as a count of `Rep` ticks, each `Period`
+/// seconds long.
+template <typename Rep, typename Period>
+class BasicDuration {
+ public:
+  using rep = Rep;
+  using period = typename Period::type;
+
+  static_assert(Period::num > 0, "Period must be positive");
+
+  /// Constructs zero duration.
+  constexpr BasicDuration() : count_(0) {}
+
+  /// Constructs a duration of `count` ticks.
+  constexpr explicit BasicDuration(Rep count) : count_(count) {}
+
+  /// Converts from another resolution or storage type, without loss.
+  template <typename Rep2, typename Period2,
+            std::enable_if_t<internal::IsLosslessDuration<Rep2, Period2, Rep,
+                                                          Period>(),
+                             int> = 0>
+  constexpr BasicDuration(const BasicDuration<Rep2, Period2>& other)
+      : count_(internal::ConvertCount<Rep, Period2, Period>(other.count())) {}
+
+  /// Converts from another resolution or storage type, truncating toward
+  /// zero.
+  template <typename Rep2, typename Period2,
+            std::enable_if_t<!internal::IsLosslessDuration<Rep2, Period2, Rep,
+                                                           Period>(),
+                             int> = 0>
+  constexpr explicit BasicDuration(const BasicDuration<Rep2, Period2>& other)
+      : count_(internal::ConvertCount<Rep, Period2, Period>(other.count())) {}
+
+  /// Converts from `Duration`. Implicit if lossless.
+  template <typename D,
+            std::enable_if_t<std::is_same<D, Duration>::value &&
+                                 internal::IsLosslessDuration<
+                                     int64_t, std::micro, Rep, Period>(),
+                             int> = 0>
+  constexpr BasicDuration(const D& d)
+      : BasicDuration(BasicDuration<int64_t, std::micro>(d.inMicros())) {}
+
+  template <typename D,
+            std::enable_if_t<std::is_same<D, Duration>::value &&
+                                 !internal::IsLosslessDuration<
+                                     int64_t, std::micro, Rep, Period>(),
+                             int> = 0>
+  constexpr explicit BasicDuration(const D& d)
+      : BasicDuration(BasicDuration<int64_t, std::micro>(d.inMicros())) {}
+
+  /// Converts to `Duration`. Implicit if lossless.
+  template <typename D = Duration,
+            std::enable_if_t<std::is_same<D, Duration>::value &&
+                                 internal::IsLosslessDuration<
+                                     Rep, Period, int64_t, std::micro>(),
+                             int> = 0>
+  constexpr operator D() const {
+    return Micros(internal::ConvertCount<int64_t, Period, std::micro>(count_));
+  }
+
+  template <typename D = Duration,
+            std::enable_if_t<std::is_same<D, Duration>::value &&
+                                 !internal::IsLosslessDuration<
+                                     Rep, Period, int64_t, std::micro>(),
+                             int> = 0>
+  constexpr explicit operator D() const {
+    return Micros(internal::ConvertCount<int64_t, Period, std::micro>(count_));
+  }
+
+  /// Returns the zero duration.
+  static constexpr BasicDuration Zero() { return BasicDuration(); }
+
+  /// Returns the largest representable duration.
+  static constexpr BasicDuration Max() {
+    return BasicDuration(std::numeric_limits<Rep>::max());
+  }
+
+  /// Returns the smallest (most negative) representable duration.
+  static constexpr BasicDuration Min() {
+    return BasicDuration(std::numeric_limits<Rep>::lowest());
+  }
+
+  /// Returns the number of ticks.
+  [[nodiscard]] constexpr Rep count() const { return count_; }
+
+  constexpr BasicDuration& operator+=(const BasicDuration& other) {
+    count_ += other.count_;
+    return *this;
+  }
+
+  constexpr BasicDuration& operator-=(const BasicDuration& other) {
+    count_ -= other.count_;
+    return *this;
+  }
+
+  constexpr BasicDuration& operator*=(Rep factor) {
+    count_ *= factor;
+    return *this;
+  }
+
+  constexpr BasicDuration& operator/=(Rep divisor) {
+    count_ /= divisor;
+    return *this;
+  }
+
+  friend constexpr BasicDuration operator-(const BasicDuration& d) {
+    return BasicDuration(-d.count_);
+  }
+
+  friend constexpr BasicDuration operator*(const BasicDuration& d, Rep factor) {
+    return BasicDuration(d.count_ * factor);
+  }
+
+  friend constexpr BasicDuration operator*(Rep factor, const BasicDuration& d) {
+    return BasicDuration(d.count_ * factor);
+  }
+
+  /// Divides by a scalar, truncating toward zero.
+  friend constexpr BasicDuration operator/(const BasicDuration& d,
+                                           Rep divisor) {
+    return BasicDuration(d.count_ / divisor);
+  }
+
+ private:
+  Rep count_;
+};
+
+namespace internal {
+
+constexpr BasicDuration<int64_t, std::micro> AsBasicDuration<Duration>::Convert(
+    Duration d) {
+  return type(d.inMicros());
+}
+
+}  // namespace internal
+
+/// Returns the sum of two durations, at their common resolution.
+template <typename A, typename B>
+constexpr internal::CommonDurationT<A, B> operator+(const A& a, const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return C(internal::ToCommon<C>(a).count() + internal::ToCommon<C>(b).count());
+}
+
+/// Returns the difference of two durations, at their common resolution.
+template <typename A, typename B>
+constexpr internal::CommonDurationT<A, B> operator-(const A& a, const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return C(internal::ToCommon<C>(a).count() - internal::ToCommon<C>(b).count());
+}
+
+/// Returns the ratio of two durations, truncated toward zero for integer
+/// representations.
+template <typename A, typename B>
+constexpr typename internal::CommonDurationT<A, B>::rep operator/(
+    const A& a, const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return internal::ToCommon<C>(a).count() / internal::ToCommon<C>(b).count();
+}
+
+template <typename A, typename B>
+constexpr internal::IfDurations<A, B, bool> operator==(const A& a,
+                                                       const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return internal::ToCommon<C>(a).count() == internal::ToCommon<C>(b).count();
+}
+
+template <typename A, typename B>
+constexpr internal::IfDurations<A, B, bool> operator!=(const A& a,
+                                                       const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return internal::ToCommon<C>(a).count() != internal::ToCommon<C>(b).count();
+}
+
+template <typename A, typename B>
+constexpr internal::IfDurations<A, B, bool> operator<(const A& a,
+                                                       const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return internal::ToCommon<C>(a).count() < internal::ToCommon<C>(b).count();
+}
+
+template <typename A, typename B>
+constexpr internal::IfDurations<A, B, bool> operator<=(const A& a,
+                                                       const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return internal::ToCommon<C>(a).count() <= internal::ToCommon<C>(b).count();
+}
+
+template <typename A, typename B>
+constexpr internal::IfDurations<A, B, bool> operator>(const A& a,
+                                                       const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return internal::ToCommon<C>(a).count() > internal::ToCommon<C>(b).count();
+}
+
+template <typename A, typename B>
+constexpr internal::IfDurations<A, B, bool> operator>=(const A& a,
+                                                       const B& b) {
+  using C = internal::CommonDurationT<A, B>;
+  return internal::ToCommon<C>(a).count() >= internal::ToCommon<C>(b).count();
+}
+
+/// A point in time, stored as a `BasicDuration<Rep, Period>` since the origin
+/// identified by `Tag`: device start for `UptimeTag`, and the Unix epoch for
+/// `WallTimeTag`. Use through the `BasicUptime` and `BasicWallTime` aliases.
+template <typename Tag, typename Rep, typename Period>
+class BasicTimePoint {
+ public:
+  using tag = Tag;
+  using duration = BasicDuration<Rep, Period>;
+  using rep = Rep;
+  using period = typename Period::type;
+
+  /// Constructs the time point at the origin.
+  constexpr BasicTimePoint() : since_epoch_() {}
+
+  /// Constructs the time point at `since_epoch` after the origin.
+  constexpr explicit BasicTimePoint(duration since_epoch)
+      : since_epoch_(since_epoch) {}
+
+  /// Converts from another resolution or storage type, without loss.
+  template <typename Rep2, typename Period2,
+            std::enable_if_t<internal::IsLosslessDuration<Rep2, Period2, Rep,
+                                                          Period>(),
+                             int> = 0>
+  constexpr BasicTimePoint(const BasicTimePoint<Tag, Rep2, Period2>& other)
+      : since_epoch_(other.sinceEpoch()) {}
+
+  /// Converts from another resolution or storage type, truncating toward
+  /// zero (i.e., toward the origin).
+  template <typename Rep2, typename Period2,
+            std::enable_if_t<!internal::IsLosslessDuration<Rep2, Period2, Rep,
+                                                           Period>(),
+                             int> = 0>
+  constexpr explicit BasicTimePoint(
+      const BasicTimePoint<Tag, Rep2, Period2>& other)
+      : since_epoch_(other.sinceEpoch()) {}
+
+  /// Converts from `Uptime` or `WallTime` (matching `Tag`). Implicit if
+  /// lossless.
+  template <typename T,
+            std::enable_if_t<
+                std::is_same<T, typename internal::TimePointTraits<
+                                    Tag>::Legacy>::value &&
+                    internal::IsLosslessDuration<int64_t, std::micro, Rep,
+                                                 Period>(),
+                int> = 0>
+  constexpr BasicTimePoint(const T& t)
+      : since_epoch_(BasicDuration<int64_t, std::micro>(
+            internal::TimePointTraits<Tag>::ToMicros(t))) {}
+
+  template <typename T,
+            std::enable_if_t<
+                std::is_same<T, typename internal::TimePointTraits<
+                                    Tag>::Legacy>::value &&
+                    !internal::IsLosslessDuration<int64_t, std::micro, Rep,
+                                                  Period>(),
+                int> = 0>
+  constexpr explicit BasicTimePoint(const T& t)
+      : since_epoch_(BasicDuration<int64_t, std::micro>(
+            internal::TimePointTraits<Tag>::ToMicros(t))) {}
+
+  /// Converts to `Uptime` or `WallTime` (matching `Tag`). Implicit if
+  /// lossless.
+  template <typename T = typename internal::TimePointTraits<Tag>::Legacy,
+            std::enable_if_t<
+                std::is_same<T, typename internal::TimePointTraits<
+                                    Tag>::Legacy>::value &&
+                    internal::IsLosslessDuration<Rep, Period, int64_t,
+                                                 std::micro>(),
+                int> = 0>
+  constexpr operator T() const {
+    return internal::TimePointTraits<Tag>::FromMicros(
+        internal::ConvertCount<int64_t, Period, std::micro>(
+            since_epoch_.count()));
+  }
+
+  template <typename T = typename internal::TimePointTraits<Tag>::Legacy,
+            std::enable_if_t<
+                std::is_same<T, typename internal::TimePointTraits<
+                                    Tag>::Legacy>::value &&
+                    !internal::IsLosslessDuration<Rep, Period, int64_t,
+                                                  std::micro>(),
+                int> = 0>
+  constexpr explicit operator T() const {
+    return internal::TimePointTraits<Tag>::FromMicros(
+        internal::ConvertCount<int64_t, Period, std::micro>(
+            since_epoch_.count()));
+  }
+
+  /// Returns the time elapsed since the origin.
+  [[nodiscard]] constexpr duration sinceEpoch() const { return since_epoch_; }
+
+  constexpr BasicTimePoint& operator+=(const duration& d) {
+    since_epoch_ += d;
+    return *this;
+  }
+
+  constexpr BasicTimePoint& operator-=(const duration& d) {
+    since_epoch_ -= d;
+    return *this;
+  }
+
+ private:
+  duration since_epoch_;
+};
+
+namespace internal {
+
+constexpr BasicTimePoint<UptimeTag, int64_t, std::micro>
+AsBasicTimePoint<Uptime>::Convert(Uptime t) {
+  return type(BasicDuration<int64_t, std::micro>(t.inMicros()));
+}
+
+constexpr BasicTimePoint<WallTimeTag, int64_t, std::micro>
+AsBasicTimePoint<WallTime>::Convert(WallTime t) {
+  return type(BasicDuration<int64_t, std::micro>(t.sinceEpoch().inMicros()));
+}
+
+}  // namespace internal
+
+/// Returns time point `t` shifted by duration `d`, at their common
+/// resolution.
+template <typename T, typename D>
+constexpr internal::ShiftedTimePointT<T, D> operator+(const T& t,
+                                                      const D& d) {
+  using R = internal::ShiftedTimePointT<T, D>;
+  using C = typename R::duration;
+  return R(internal::ToCommon<C>(
+               internal::AsBasicTimePoint<T>::Convert(t).sinceEpoch()) +
+           internal::ToCommon<C>(d));
+}
+
+/// Returns time point `t` shifted by duration `d`, at their common
+/// resolution.
+template <typename D, typename T>
+constexpr internal::ShiftedTimePointT<T, D> operator+(const D& d,
+                                                      const T& t) {
+  return t + d;
+}
+
+/// Returns time point `t` shifted backwards by duration `d`, at their common
+/// resolution.
+template <typename T, typename D>
+constexpr internal::ShiftedTimePointT<T, D> operator-(const T& t,
+                                                      const D& d) {
+  using R = internal::ShiftedTimePointT<T, D>;
+  using C = typename R::duration;
+  return R(internal::ToCommon<C>(
+               internal::AsBasicTimePoint<T>::Convert(t).sinceEpoch()) -
+           internal::ToCommon<C>(d));
+}
+
+/// Returns the time elapsed between two time points, at their common
+/// resolution.
+template <typename A, typename B>
+constexpr typename internal::CommonTimePointT<A, B>::duration operator-(
+    const A& a, const B& b) {
+  using C = internal::CommonTimePointT<A, B>;
+  return internal::ToCommonTimePoint<C>(a).sinceEpoch() -
+         internal::ToCommonTimePoint<C>(b).sinceEpoch();
+}
+
+template <typename A, typename B>
+constexpr internal::IfTimePoints<A, B, bool> operator==(const A& a,
+                                                        const B& b) {
+  using C = internal::CommonTimePointT<A, B>;
+  return internal::ToCommonTimePoint<C>(a).sinceEpoch() ==
+         internal::ToCommonTimePoint<C>(b).sinceEpoch();
+}
+
+template <typename A, typename B>
+constexpr internal::IfTimePoints<A, B, bool> operator!=(const A& a,
+                                                        const B& b) {
+  using C = internal::CommonTimePointT<A, B>;
+  return internal::ToCommonTimePoint<C>(a).sinceEpoch() !=
+         internal::ToCommonTimePoint<C>(b).sinceEpoch();
+}
+
+template <typename A, typename B>
+constexpr internal::IfTimePoints<A, B, bool> operator<(const A& a,
+                                                        const B& b) {
+  using C = internal::CommonTimePointT<A, B>;
+  return internal::ToCommonTimePoint<C>(a).sinceEpoch() <
+         internal::ToCommonTimePoint<C>(b).sinceEpoch();
+}
+
+template <typename A, typename B>
+constexpr internal::IfTimePoints<A, B, bool> operator<=(const A& a,
+                                                        const B& b) {
+  using C = internal::CommonTimePointT<A, B>;
+  return internal::ToCommonTimePoint<C>(a).sinceEpoch() <=
+         internal::ToCommonTimePoint<C>(b).sinceEpoch();
+}
+
+template <typename A, typename B>
+constexpr internal::IfTimePoints<A, B, bool> operator>(const A& a,
+                                                        const B& b) {
+  using C = internal::CommonTimePointT<A, B>;
+  return internal::ToCommonTimePoint<C>(a).sinceEpoch() >
+         internal::ToCommonTimePoint<C>(b).sinceEpoch();
+}
+
+template <typename A, typename B>
+constexpr internal::IfTimePoints<A, B, bool> operator>=(const A& a,
+                                                        const B& b) {
+  using C = internal::CommonTimePointT<A, B>;
+  return internal::ToCommonTimePoint<C>(a).sinceEpoch() >=
+         internal::ToCommonTimePoint<C>(b).sinceEpoch();
+}
+
+/// A time point since device start, like `Uptime`.
+template <typename Rep, typename Period>
+using BasicUptime = BasicTimePoint<UptimeTag, Rep, Period>;
+
+/// A time point since the Unix epoch, like `WallTime`.
+template <typename Rep, typename Period>
+using BasicWallTime = BasicTimePoint<WallTimeTag, Rep, Period>;
+
+using NanosDuration = BasicDuration<int64_t, std::nano>;
+
+/// Same resolution and range as `Duration`, and implicitly convertible to and
+/// from it.
+using MicrosDuration = BasicDuration<int64_t, std::micro>;
+
+using MillisDuration = BasicDuration<int64_t, std::milli>;
+
+/// Covers about +/-24 days.
+using MillisDuration32 = BasicDuration<int32_t, std::milli>;
+
+using SecondsDuration = BasicDuration<int64_t, std::ratio<1>>;
+
+/// Ticks of a clock running at `kTicksPerSecond`, e.g. an RTOS tick.
+template <intmax_t kTicksPerSecond, typename Rep = int64_t>
+using TicksDuration = BasicDuration<Rep, std::ratio<1, kTicksPerSecond>>;
+
+using NanosUptime = BasicUptime<int64_t, std::nano>;
+using MicrosUptime = BasicUptime<int64_t, std::micro>;
+using MillisUptime = BasicUptime<int64_t, std::milli>;
+
+using NanosWallTime = BasicWallTime<int64_t, std::nano>;
+using MicrosWallTime = BasicWallTime<int64_t, std::micro>;
+using MillisWallTime = BasicWallTime<int64_t, std::milli>;
+
+/// Unix time.
+using SecondsWallTime = BasicWallTime<int64_t, std::ratio<1>>;
+
+}  // namespace roo_time
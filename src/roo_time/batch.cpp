@@ -0,0 +1,124 @@
+#include "roo_time/batch.h"
+
+#include "roo_time/internal/calendar.h"
+
+namespace roo_time {
+
+namespace {
+
+// Number of elements processed per block. Keeps the intermediate arrays small
+// enough to live on the stack (and in L1) even on microcontrollers.
+constexpr size_t kBlockSize = 64;
+
+// Splits wall times into day numbers, seconds since midnight, and microsecond
+// fractions. This is the only pass that needs 64-bit arithmetic.
+void SplitBlock(const WallTime* wall_times, size_t count, int64_t offset_micros,
+                int32_t* days, uint32_t* seconds_of_day, uint32_t* micros) {
+  for (size_t i = 0; i < count; ++i) {
+    int64_t t = wall_times[i].sinceEpoch().inMicros() + offset_micros;
+    int64_t seconds = internal::floor_div<int64_t>(t, 1000000LL);
+    micros[i] = static_cast<uint32_t>(t - seconds * 1000000LL);
+    int64_t d = internal::floor_div<int64_t>(seconds, 24 * 3600);
+    days[i] = static_cast<int32_t>(d);
+    seconds_of_day[i] = static_cast<uint32_t>(seconds - d * 24 * 3600);
+  }
+}
+
+void FillTimeOfDay(size_t count, const uint32_t* seconds_of_day,
+                   const uint32_t* micros, const CivilColumns& out,
+                   size_t pos) {
+  if (out.hour != nullptr) {
+    uint8_t* hour = out.hour + pos;
+    for (size_t i = 0; i < count; ++i) {
+      hour[i] = seconds_of_day[i] / 3600;
+    }
+  }
+  if (out.minute != nullptr) {
+    uint8_t* minute = out.minute + pos;
+    for (size_t i = 0; i < count; ++i) {
+      minute[i] = (seconds_of_day[i] / 60) % 60;
+    }
+  }
+  if (out.second != nullptr) {
+    uint8_t* second = out.second + pos;
+    for (size_t i = 0; i < count; ++i) {
+      second[i] = seconds_of_day[i] % 60;
+    }
+  }
+  if (out.micros != nullptr) {
+    uint32_t* us = out.micros + pos;
+    for (size_t i = 0; i < count; ++i) {
+      us[i] = micros[i];
+    }
+  }
+}
+
+void FillDate(size_t count, const int32_t* days, const CivilColumns& out,
+              size_t pos) {
+  if (out.day_of_week != nullptr) {
+    uint8_t* dow = out.day_of_week + pos;
+    for (size_t i = 0; i < count; ++i) {
+      dow[i] = internal::weekday_from_days(days[i]);
+    }
+  }
+  if (out.year == nullptr && out.month == nullptr && out.day == nullptr &&
+      out.day_of_year == nullptr) {
+    return;
+  }
+  int16_t year[kBlockSize];
+  uint8_t month[kBlockSize];
+  uint8_t day[kBlockSize];
+  for (size_t i = 0; i < count; ++i) {
+    internal::civil_from_days(days[i], &year[i], &month[i], &day[i]);
+  }
+  if (out.year != nullptr) {
+    for (size_t i = 0; i < count; ++i) out.year[pos + i] = year[i];
+  }
+  if (out.month != nullptr) {
+    for (size_t i = 0; i < count; ++i) out.month[pos + i] = month[i];
+  }
+  if (out.day != nullptr) {
+    for (size_t i = 0; i < count; ++i) out.day[pos + i] = day[i];
+  }
+  if (out.day_of_year != nullptr) {
+    uint16_t* doy = out.day_of_year + pos;
+    for (size_t i = 0; i < count; ++i) {
+      doy[i] = internal::day_of_year(year[i], month[i], day[i]);
+    }
+  }
+}
+
+}  // namespace
+
+void DecomposeWallTimes(const WallTime* wall_times, size_t count, TimeZone tz,
+                        const CivilColumns& out) {
+  int64_t offset_micros = tz.offset().inMicros();
+  int32_t days[kBlockSize];
+  uint32_t seconds_of_day[kBlockSize];
+  uint32_t micros[kBlockSize];
+  for (size_t pos = 0; pos < count; pos += kBlockSize) {
+    size_t n = count - pos < kBlockSize ? count - pos : kBlockSize;
+    SplitBlock(wall_times + pos, n, offset_micros, days, seconds_of_day,
+               micros);
+    FillTimeOfDay(n, seconds_of_day, micros, out, pos);
+    FillDate(n, days, out, pos);
+  }
+}
+
+void DecomposeWallTimesScalar(const WallTime* wall_times, size_t count,
+                              TimeZone tz, const CivilColumns& out) {
+  for (size_t i = 0; i < count; ++i) {
+    DateTime dt(wall_times[i], tz);
+    if (out.year != nullptr) out.year[i] = dt.year();
+    if (out.month != nullptr) out.month[i] = dt.month();
+    if (out.day != nullptr) out.day[i] = dt.day();
+    if (out.hour != nullptr) out.hour[i] = dt.hour();
+    if (out.minute != nullptr) out.minute[i] = dt.minute();
+    if (out.second != nullptr) out.second[i] = dt.second();
+    if (out.micros != nullptr) out.micros[i] = dt.micros();
+    if (out.day_of_week != nullptr) out.day_of_week[i] = dt.dayOfWeek();
+    if (out.day_of_year != nullptr) out.day_of_year[i] = dt.dayOfYear();
+  }
+}
+
+}  // namespace roo_time
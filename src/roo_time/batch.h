@@ -0,0 +1,48 @@
+#pragma once
+
+/// Bulk conversion of wall times into calendar fields.
+///
+/// Intended for hot paths (e.g. log ingestion) that would otherwise construct
+/// a `DateTime` per timestamp only to read a few of its fields.
+
+#include <stddef.h>
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Structure-of-arrays destination for `DecomposeWallTimes()`.
+///
+/// Each non-null pointer must designate an array with room for at least
+/// `count` elements. Columns left as nullptr are not computed. Values have the
+/// same meaning as the corresponding `DateTime` accessors.
+struct CivilColumns {
+  int16_t* year = nullptr;
+  uint8_t* month = nullptr;
+  uint8_t* day = nullptr;
+  uint8_t* hour = nullptr;
+  uint8_t* minute = nullptr;
+  uint8_t* second = nullptr;
+  uint32_t* micros = nullptr;
+
+  /// Day of week, as `DayOfWeek` values in [0, 6].
+  uint8_t* day_of_week = nullptr;
+
+  uint16_t* day_of_year = nullptr;
+};
+
+/// Decomposes `count` wall times, in time zone `tz`, into calendar fields.
+///
+/// Produces results identical to constructing `DateTime(wall_times[i], tz)`
+/// and reading its fields. Processes input in fixed-size blocks, computing
+/// the day number and time of day once per element, and then filling each
+/// requested column in a separate tight loop amenable to auto-vectorization.
+void DecomposeWallTimes(const WallTime* wall_times, size_t count, TimeZone tz,
+                        const CivilColumns& out);
+
+/// Reference implementation of `DecomposeWallTimes()`, going through the
+/// `DateTime` constructor for each element.
+void DecomposeWallTimesScalar(const WallTime* wall_times, size_t count,
+                              TimeZone tz, const CivilColumns& out);
+
+}  // namespace roo_time
@@ -0,0 +1,65 @@
+#include "roo_time/cached_timestamp_formatter.h"
+
+#include <string.h>
+
+#include "roo_time/internal/calendar.h"
+#include "roo_time/internal/digits.h"
+
+namespace roo_time {
+
+CachedTimestampFormatter::CachedTimestampFormatter(TimeZone tz,
+                                                   uint8_t fraction_digits,
+                                                   char separator)
+    : tz_(tz),
+      fraction_digits_(fraction_digits > 6 ? 6 : fraction_digits),
+      separator_(separator),
+      second_start_(1),
+      second_end_(0),
+      prefix_length_(0),
+      text_() {}
+
+size_t CachedTimestampFormatter::format(WallTime t, char* buf, size_t size) {
+  int64_t micros = t.sinceEpoch().inMicros();
+  if (micros < second_start_ || micros >= second_end_) renderSecond(micros);
+  size_t len = prefix_length_ + fraction_digits_;
+  if (len >= size) {
+    if (size > 0) buf[0] = '\0';
+    return 0;
+  }
+  char* fraction = buf + prefix_length_;
+  if (size > kMaxLength) {
+    // Common case: copy fixed-size blocks, which compiles to a few wide moves,
+    // then overwrite the tail. (A variable-length copy, or patching digits
+    // into text_ before copying, are several times slower.)
+    memcpy(buf, text_, kMaxLength);
+    internal::write_6_digits(fraction, micros - second_start_);
+  } else {
+    memcpy(buf, text_, prefix_length_);
+    char digits[6];
+    internal::write_6_digits(digits, micros - second_start_);
+    memcpy(fraction, digits, fraction_digits_);
+  }
+  buf[len] = '\0';
+  return len;
+}
+
+void CachedTimestampFormatter::renderSecond(int64_t micros) {
+  DateTime dt(WallTime(Micros(micros)), tz_);
+  char* p = internal::write_iso_year(text_, dt.year());
+  *p++ = '-';
+  p = internal::write_2_digits(p, dt.month());
+  *p++ = '-';
+  p = internal::write_2_digits(p, dt.day());
+  *p++ = separator_;
+  p = internal::write_2_digits(p, dt.hour());
+  *p++ = ':';
+  p = internal::write_2_digits(p, dt.minute());
+  *p++ = ':';
+  p = internal::write_2_digits(p, dt.second());
+  if (fraction_digits_ > 0) *p++ = '.';
+  prefix_length_ = p - text_;
+  second_start_ = micros - internal::floor_mod<int64_t>(micros, 1000000);
+  second_end_ = second_start_ + 1000000;
+}
+
+}  // namespace roo_time
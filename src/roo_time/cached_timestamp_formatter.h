@@ -0,0 +1,67 @@
+#pragma once
+
+/// Fast formatting of timestamps for log lines.
+
+#include <stddef.h>
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Formats wall times as local "YYYY-MM-DD HH:MM:SS.fff" timestamps, caching
+/// the rendered date and time of day for the current second.
+///
+/// Intended for loggers, which format many timestamps within the same second.
+/// When the wall time falls within the cached second, the cached text is
+/// copied and only the sub-second digits are written; otherwise, the text is
+/// rendered from a `DateTime`, and cached.
+///
+/// Not thread-safe; use one instance per thread.
+class CachedTimestampFormatter {
+ public:
+  /// Maximum length of a formatted timestamp, excluding the terminating NUL,
+  /// e.g. "-32768-01-01 00:00:00.000000".
+  static constexpr size_t kMaxLength = 28;
+
+  /// Creates the formatter.
+  ///
+  /// @param tz Time zone to render the local time in.
+  /// @param fraction_digits Number of fractional second digits, in [0, 6].
+  ///        When 0, the fraction is omitted altogether.
+  /// @param separator Character separating date and time, e.g. ' ' or 'T'.
+  explicit CachedTimestampFormatter(TimeZone tz = timezone::UTC,
+                                    uint8_t fraction_digits = 3,
+                                    char separator = ' ');
+
+  /// Returns the time zone used by this formatter.
+  [[nodiscard]] TimeZone timeZone() const { return tz_; }
+
+  /// Writes `t` as a NUL-terminated string into `buf`, which has room for
+  /// `size` characters.
+  ///
+  /// Returns the length of the string, excluding the terminating NUL. If the
+  /// string does not fit, writes an empty string (if `size` > 0) and returns 0.
+  size_t format(WallTime t, char* buf, size_t size);
+
+ private:
+  // Renders the date and time of day of the second containing `micros`
+  // (since Epoch), and caches it.
+  void renderSecond(int64_t micros);
+
+  TimeZone tz_;
+  uint8_t fraction_digits_;
+  char separator_;
+
+  // Cached second, as [second_start_, second_end_) in microseconds since
+  // Epoch. Empty when nothing is cached.
+  int64_t second_start_;
+  int64_t second_end_;
+
+  // Length of the cached text, including the decimal point.
+  uint8_t prefix_length_;
+
+  // The cached text, followed by the decimal point (if any).
+  char text_[kMaxLength];
+};
+
+}  // namespace roo_time
@@ -0,0 +1,108 @@
+#pragma once
+
+/// Interoperability with `std::chrono`.
+///
+/// Converts between `Duration`, `Uptime`, `WallTime` and their `std::chrono`
+/// counterparts. Where the representations match (e.g. `Duration` and
+/// `std::chrono::microseconds`), conversions are constant expressions that
+/// compile to nothing.
+///
+/// Also provides `UptimeClock`, which meets the standard Clock requirements,
+/// so that `Uptime` can be used with `std::chrono` algorithms, e.g.
+/// `std::this_thread::sleep_until()` or `std::condition_variable::wait_until()`.
+
+#include <chrono>
+
+#include "roo_time.h"
+#include "roo_time/basic_duration.h"
+
+namespace roo_time {
+
+/// A `std::chrono` clock measuring `Uptime`.
+struct UptimeClock {
+  using rep = int64_t;
+  using period = std::micro;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<UptimeClock>;
+
+  /// `Uptime::Now()` never decreases.
+  static constexpr bool is_steady = true;
+
+  static time_point now() noexcept {
+    return time_point(duration(Uptime::Now().inMicros()));
+  }
+};
+
+/// Converts `Duration` to `std::chrono::microseconds`. Exact.
+constexpr std::chrono::microseconds ToChrono(Duration d) {
+  return std::chrono::microseconds(d.inMicros());
+}
+
+/// Converts a `std::chrono::duration` to `Duration`, truncating toward zero
+/// to microseconds (like `std::chrono::duration_cast`).
+template <typename Rep, typename Period>
+constexpr Duration FromChrono(std::chrono::duration<Rep, Period> d) {
+  return Micros(
+      std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+}
+
+/// Converts `BasicDuration` to the `std::chrono::duration` with the same
+/// representation and period. Exact.
+template <typename Rep, typename Period>
+constexpr std::chrono::duration<Rep, Period> ToChrono(
+    BasicDuration<Rep, Period> d) {
+  return std::chrono::duration<Rep, Period>(d.count());
+}
+
+/// Converts a `std::chrono::duration` to the `BasicDuration` with the same
+/// representation and period, e.g. `std::chrono::nanoseconds` to
+/// `NanosDuration`. Exact.
+template <typename Rep, typename Period>
+constexpr BasicDuration<Rep, Period> ToBasicDuration(
+    std::chrono::duration<Rep, Period> d) {
+  return BasicDuration<Rep, Period>(d.count());
+}
+
+/// Converts `Uptime` to a time point of `UptimeClock`. Exact.
+constexpr UptimeClock::time_point ToChrono(Uptime t) {
+  return UptimeClock::time_point(UptimeClock::duration(t.inMicros()));
+}
+
+/// Converts a time point of `UptimeClock` to `Uptime`. Exact.
+constexpr Uptime FromChrono(UptimeClock::time_point t) {
+  return Uptime::Start() + Micros(t.time_since_epoch().count());
+}
+
+/// Converts `WallTime` to a time point of `std::chrono::system_clock`, whose
+/// epoch is the Unix epoch. Exact if `system_clock` has microsecond or finer
+/// resolution (as it does on Linux).
+constexpr std::chrono::system_clock::time_point ToChrono(WallTime t) {
+  return std::chrono::system_clock::time_point(
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          ToChrono(t.sinceEpoch())));
+}
+
+/// Converts a time point of `std::chrono::system_clock` to `WallTime`,
+/// truncating toward the epoch to microseconds.
+constexpr WallTime FromChrono(std::chrono::system_clock::time_point t) {
+  return WallTime(FromChrono(t.time_since_epoch()));
+}
+
+/// Converts a time point of `std::chrono::steady_clock` to `Uptime`.
+///
+/// The two clocks do not share an epoch, so the conversion is done by
+/// reading both clocks, and is only as exact as the time between the two
+/// readings (typically well under a microsecond).
+inline Uptime FromChrono(std::chrono::steady_clock::time_point t) {
+  return Uptime::Now() + FromChrono(t - std::chrono::steady_clock::now());
+}
+
+/// Converts `Uptime` to a time point of `std::chrono::steady_clock`. See
+/// above for precision.
+inline std::chrono::steady_clock::time_point ToSteadyClock(Uptime t) {
+  return std::chrono::steady_clock::now() +
+         std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+             ToChrono(t - Uptime::Now()));
+}
+
+}  // namespace roo_time
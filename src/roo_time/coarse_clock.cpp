@@ -0,0 +1,36 @@
+#include "roo_time/coarse_clock.h"
+
+#if ROO_TIME_COARSE_CLOCK_TICKER
+
+#include <chrono>
+
+namespace roo_time {
+
+CoarseClockTicker::CoarseClockTicker(CoarseClock& clock, Duration period)
+    : clock_(clock), period_(period), stop_(false) {
+  // Started last, once all the other members are initialized.
+  thread_ = std::thread([this] { run(); });
+}
+
+CoarseClockTicker::~CoarseClockTicker() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  stop_requested_.notify_one();
+  thread_.join();
+}
+
+void CoarseClockTicker::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    clock_.tick();
+    stop_requested_.wait_for(lock,
+                             std::chrono::microseconds(period_.inMicros()),
+                             [this] { return stop_; });
+  }
+}
+
+}  // namespace roo_time
+
+#endif  // ROO_TIME_COARSE_CLOCK_TICKER
@@ -0,0 +1,104 @@
+#pragma once
+
+/// Uptime cached by a periodic tick, for hot paths (e.g. per-packet timeout
+/// checks) where even `Uptime::Now()` is too expensive, and millisecond-level
+/// staleness is acceptable.
+///
+/// ```
+/// CoarseClock clock;
+/// CoarseClockTicker ticker(clock, Millis(1));  // Or call clock.tick().
+/// ...
+/// if (clock.now() >= deadline) { /* expired */ }
+/// ```
+
+#include <atomic>
+
+#include "roo_time.h"
+
+// When 1, provides `CoarseClockTicker`, which requires `std::thread`.
+// Defaults to 1 on Linux.
+#ifndef ROO_TIME_COARSE_CLOCK_TICKER
+#if defined(__linux__)
+#define ROO_TIME_COARSE_CLOCK_TICKER 1
+#else
+#define ROO_TIME_COARSE_CLOCK_TICKER 0
+#endif
+#endif
+
+#if ROO_TIME_COARSE_CLOCK_TICKER
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace roo_time {
+
+/// Holds the uptime as of the most recent `tick()`.
+///
+/// `now()` is a single relaxed atomic load (on platforms with lock-free
+/// 64-bit atomics; elsewhere, e.g. on 32-bit microcontrollers, the load is
+/// still safe, but slower, and there `Uptime::Now()` is usually cheap
+/// anyway).
+///
+/// Staleness: `now()` is never later than `Uptime::Now()`, and lags it by at
+/// most the interval between consecutive ticks, plus the time it takes a
+/// tick to get through.
+class CoarseClock {
+ public:
+  /// Constructs the clock, set to the current uptime.
+  CoarseClock() : micros_(Uptime::Now().inMicros()) {}
+
+  CoarseClock(const CoarseClock&) = delete;
+  CoarseClock& operator=(const CoarseClock&) = delete;
+
+  /// Returns the uptime as of the most recent tick.
+  [[nodiscard]] Uptime now() const {
+    return Uptime::Start() + Micros(micros_.load(std::memory_order_relaxed));
+  }
+
+  /// Sets the clock to `Uptime::Now()`. Call periodically, e.g. from a timer
+  /// interrupt, a main loop, or via `CoarseClockTicker`. Calls must not
+  /// overlap (i.e. tick from one thread or interrupt handler at a time).
+  void tick() {
+    micros_.store(Uptime::Now().inMicros(), std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int64_t> micros_;
+};
+
+#if ROO_TIME_COARSE_CLOCK_TICKER
+
+/// Ticks a `CoarseClock` from a background thread, every `period`, for the
+/// lifetime of this object.
+///
+/// The staleness of the clock is then bounded by `period` plus the thread's
+/// wake-up latency (typically well under a millisecond on an idle system, but
+/// unbounded under CPU contention).
+class CoarseClockTicker {
+ public:
+  /// Starts ticking `clock`, which must outlive this object.
+  CoarseClockTicker(CoarseClock& clock, Duration period);
+
+  /// Stops ticking, and joins the thread.
+  ~CoarseClockTicker();
+
+  CoarseClockTicker(const CoarseClockTicker&) = delete;
+  CoarseClockTicker& operator=(const CoarseClockTicker&) = delete;
+
+ private:
+  void run();
+
+  CoarseClock& clock_;
+  Duration period_;
+
+  std::mutex mutex_;
+  std::condition_variable stop_requested_;
+  bool stop_;
+
+  std::thread thread_;
+};
+
+#endif  // ROO_TIME_COARSE_CLOCK_TICKER
+
+}  // namespace roo_time
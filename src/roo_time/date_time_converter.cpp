@@ -0,0 +1,36 @@
+#include "roo_time/date_time_converter.h"
+
+#include "roo_time/internal/calendar.h"
+
+namespace roo_time {
+
+namespace {
+
+constexpr int64_t kMicrosPerDay = 24LL * 3600 * 1000000;
+
+}  // namespace
+
+DateTime DateTimeConverter::convert(WallTime wall_time) {
+  int64_t t = wall_time.sinceEpoch().inMicros();
+  if (t >= day_start_ && t < day_end_) {
+    // Fast path: same day as before.
+    uint64_t since_midnight = t - day_start_;
+    uint32_t micros = since_midnight % 1000000;
+    uint32_t seconds = since_midnight / 1000000;
+    return DateTime(wall_time, tz_, year_, month_, day_, seconds / 3600,
+                    (seconds / 60) % 60, seconds % 60, micros, day_of_week_,
+                    day_of_year_);
+  }
+  DateTime result(wall_time, tz_);
+  year_ = result.year();
+  month_ = result.month();
+  day_ = result.day();
+  day_of_week_ = result.dayOfWeek();
+  day_of_year_ = result.dayOfYear();
+  day_start_ =
+      t - internal::floor_mod(t + tz_.offset().inMicros(), kMicrosPerDay);
+  day_end_ = day_start_ + kMicrosPerDay;
+  return result;
+}
+
+}  // namespace roo_time
@@ -0,0 +1,55 @@
+#pragma once
+
+/// Incremental `WallTime` to `DateTime` conversion.
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Converts wall times to `DateTime` in a fixed time zone, reusing the
+/// calendar date computed for the previous call.
+///
+/// Optimized for streams of timestamps that mostly fall on the same local day
+/// (e.g. log records, sensor samples). When the wall time falls within the
+/// cached day, only the time-of-day fields are derived; otherwise, the full
+/// conversion is performed, and the new day is cached.
+///
+/// The result is always identical to `DateTime(wall_time, timeZone())`.
+///
+/// Not thread-safe; use one instance per thread (or per caller).
+class DateTimeConverter {
+ public:
+  /// Creates a converter for the specified time zone.
+  explicit DateTimeConverter(TimeZone tz = timezone::UTC)
+      : tz_(tz),
+        day_start_(0),
+        day_end_(0),
+        year_(0),
+        month_(0),
+        day_(0),
+        day_of_week_(kSunday),
+        day_of_year_(0) {}
+
+  /// Returns the time zone used by this converter.
+  [[nodiscard]] TimeZone timeZone() const { return tz_; }
+
+  /// Returns `DateTime` for `wall_time` in this converter's time zone.
+  DateTime convert(WallTime wall_time);
+
+ private:
+  TimeZone tz_;
+
+  // Cached day, as [day_start_, day_end_) in microseconds since Epoch. Empty
+  // when nothing is cached.
+  int64_t day_start_;
+  int64_t day_end_;
+
+  // Calendar fields of the cached day.
+  int16_t year_;
+  uint8_t month_;
+  uint8_t day_;
+  DayOfWeek day_of_week_;
+  uint16_t day_of_year_;
+};
+
+}  // namespace roo_time
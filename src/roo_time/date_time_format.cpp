@@ -0,0 +1,162 @@
+#include "roo_time/date_time_format.h"
+
+#include <string.h>
+
+#include "roo_time/internal/digits.h"
+
+namespace roo_time {
+
+namespace {
+
+const char* const kWeekdayNames[] = {"Sunday",   "Monday",   "Tuesday",
+                                     "Wednesday", "Thursday", "Friday",
+                                     "Saturday"};
+
+const char* const kMonthNames[] = {
+    "January", "February", "March",     "April",   "May",      "June",
+    "July",    "August",   "September", "October", "November", "December"};
+
+char* WriteString(char* p, const char* s) {
+  while (*s != '\0') *p++ = *s++;
+  return p;
+}
+
+}  // namespace
+
+size_t DateTimeFormat::format(const DateTime& dt, char* buf,
+                              size_t size) const {
+  if (size == 0) return 0;
+  char* p = buf;
+  // Leaves room for the terminating NUL.
+  char* const limit = buf + size - 1;
+  // If the buffer is large enough for any output, no per-op checks are needed.
+  const bool fits = (size > max_length_);
+  for (uint8_t i = 0; i < op_count_; ++i) {
+    const Op& op = ops_[i];
+    // Ops that might not fit are rendered into a temporary buffer first.
+    char tmp[9];
+    char* out =
+        (fits || (size_t)(limit - p) >= MaxWidth(op.kind, op.arg)) ? p : tmp;
+    char* end = out;
+    switch (op.kind) {
+      case kLiteral: {
+        *end++ = op.arg;
+        break;
+      }
+      case kYear: {
+        end = internal::write_iso_year(end, dt.year());
+        break;
+      }
+      case kYear2: {
+        int32_t y = dt.year() % 100;
+        end = internal::write_2_digits(end, y < 0 ? y + 100 : y);
+        break;
+      }
+      case kMonth: {
+        end = internal::write_2_digits(end, dt.month());
+        break;
+      }
+      case kDay: {
+        end = internal::write_2_digits(end, dt.day());
+        break;
+      }
+      case kDaySpacePadded: {
+        end = internal::write_2_digits(end, dt.day());
+        if (out[0] == '0') out[0] = ' ';
+        break;
+      }
+      case kDayOfYear: {
+        *end++ = '0' + dt.dayOfYear() / 100;
+        end = internal::write_2_digits(end, dt.dayOfYear() % 100);
+        break;
+      }
+      case kHour: {
+        end = internal::write_2_digits(end, dt.hour());
+        break;
+      }
+      case kHour12: {
+        uint8_t h = dt.hour() % 12;
+        end = internal::write_2_digits(end, h == 0 ? 12 : h);
+        break;
+      }
+      case kAmPm: {
+        *end++ = dt.hour() < 12 ? 'A' : 'P';
+        *end++ = 'M';
+        break;
+      }
+      case kMinute: {
+        end = internal::write_2_digits(end, dt.minute());
+        break;
+      }
+      case kSecond: {
+        end = internal::write_2_digits(end, dt.second());
+        break;
+      }
+      case kFraction: {
+        char fraction[6];
+        internal::write_6_digits(fraction, dt.micros());
+        memcpy(end, fraction, op.arg);
+        end += op.arg;
+        break;
+      }
+      case kWeekdayShort: {
+        memcpy(end, kWeekdayNames[dt.dayOfWeek()], 3);
+        end += 3;
+        break;
+      }
+      case kWeekdayLong: {
+        end = WriteString(end, kWeekdayNames[dt.dayOfWeek()]);
+        break;
+      }
+      case kWeekdayMonday1: {
+        *end++ = (dt.dayOfWeek() == kSunday) ? '7' : '0' + dt.dayOfWeek();
+        break;
+      }
+      case kWeekdaySunday0: {
+        *end++ = '0' + dt.dayOfWeek();
+        break;
+      }
+      case kMonthShort: {
+        memcpy(end, kMonthNames[dt.month() - 1], 3);
+        end += 3;
+        break;
+      }
+      case kMonthLong: {
+        end = WriteString(end, kMonthNames[dt.month() - 1]);
+        break;
+      }
+      case kOffset: {
+        int32_t minutes = dt.timeZone().offset().inMinutes();
+        if (!internal::utc_offset_fits(minutes)) {
+          buf[0] = '\0';
+          return 0;
+        }
+        end = internal::write_utc_offset(end, minutes, false);
+        break;
+      }
+      case kOffsetColon: {
+        int32_t minutes = dt.timeZone().offset().inMinutes();
+        if (!internal::utc_offset_fits(minutes)) {
+          buf[0] = '\0';
+          return 0;
+        }
+        end = internal::write_utc_offset(end, minutes, true);
+        break;
+      }
+    }
+    if (out == tmp) {
+      size_t len = end - tmp;
+      if ((size_t)(limit - p) < len) {
+        buf[0] = '\0';
+        return 0;
+      }
+      memcpy(p, tmp, len);
+      end = p + len;
+    }
+    p = end;
+  }
+  *p = '\0';
+  return p - buf;
+}
+
+}  // namespace roo_time
@@ -0,0 +1,229 @@
+#pragma once
+
+/// Precompiled strftime-style formatting of `DateTime`.
+
+#include <stddef.h>
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// strftime-like format, compiled once into a compact list of operations, and
+/// then rendered without re-parsing the pattern.
+///
+/// Supported conversions:
+///
+///   %Y  year, at least 4 digits ("2024")
+///   %y  last two digits of the year ("24")
+///   %m  month, 2 digits ("07")
+///   %d  day of month, 2 digits ("01")
+///   %e  day of month, space-padded (" 1")
+///   %j  day of year, 3 digits ("183")
+///   %H  hour, 2 digits ("14")
+///   %I  hour on a 12-hour clock, 2 digits ("02")
+///   %p  "AM" or "PM"
+///   %M  minute, 2 digits ("05")
+///   %S  second, 2 digits ("09")
+///   %f  microseconds, 6 digits ("250000"); %1f .. %6f truncate to N digits
+///   %a  abbreviated day of week ("Mon")
+///   %A  day of week ("Monday")
+///   %u  day of week as a number in [1, 7], Monday = 1
+///   %w  day of week as a number in [0, 6], Sunday = 0
+///   %b  abbreviated month name ("Jul"); %h is a synonym
+///   %B  month name ("July")
+///   %z  UTC offset ("+0200")
+///   %:z UTC offset with a colon ("+02:00")
+///   %F  same as %Y-%m-%d
+///   %T  same as %H:%M:%S
+///   %R  same as %H:%M
+///   %D  same as %m/%d/%y
+///   %%  a literal '%'
+///
+/// Names are in English, regardless of locale.
+///
+/// The constructor is constexpr, so formats can be compiled at build time:
+///
+/// ```cpp
+/// constexpr DateTimeFormat kFormat("%d.%m.%Y %H:%M");
+/// static_assert(kFormat.ok(), "Malformed format");
+///
+/// char buf[kFormat.maxLength() + 1];
+/// kFormat.format(dt, buf, sizeof(buf));
+/// ```
+class DateTimeFormat {
+ public:
+  /// Maximum number of operations (conversions and literal characters) in a
+  /// compiled format.
+  static constexpr int kMaxOps = 48;
+
+  /// Compiles the specified pattern. If the pattern is malformed (contains an
+  /// unsupported conversion), or too long, `ok()` returns false, and the
+  /// format renders as an empty string.
+  constexpr explicit DateTimeFormat(const char* pattern)
+      : ops_(), op_count_(0), max_length_(0), ok_(true) {
+    compile(pattern);
+    if (!ok_) {
+      op_count_ = 0;
+      max_length_ = 0;
+    }
+  }
+
+  /// Returns true if the pattern has been compiled successfully.
+  [[nodiscard]] constexpr bool ok() const { return ok_; }
+
+  /// Returns the maximum length of a rendered string, excluding the
+  /// terminating NUL.
+  [[nodiscard]] constexpr size_t maxLength() const { return max_length_; }
+
+  /// Renders `dt` as a NUL-terminated string into `buf`, which has room for
+  /// `size` characters.
+  ///
+  /// Returns the length of the string, excluding the terminating NUL. If the
+  /// string does not fit, or the pattern has `%z` or `%:z` and the UTC offset
+  /// is 100 hours or more (which no real time zone has), writes an empty
+  /// string (if `size` > 0) and returns 0.
+  size_t format(const DateTime& dt, char* buf, size_t size) const;
+
+ private:
+  enum OpKind : uint8_t {
+    kLiteral,
+    kYear,
+    kYear2,
+    kMonth,
+    kDay,
+    kDaySpacePadded,
+    kDayOfYear,
+    kHour,
+    kHour12,
+    kAmPm,
+    kMinute,
+    kSecond,
+    kFraction,
+    kWeekdayShort,
+    kWeekdayLong,
+    kWeekdayMonday1,
+    kWeekdaySunday0,
+    kMonthShort,
+    kMonthLong,
+    kOffset,
+    kOffsetColon,
+  };
+
+  struct Op {
+    OpKind kind = kLiteral;
+
+    // The character, for kLiteral; the number of digits, for kFraction.
+    char arg = 0;
+  };
+
+  // Returns the maximum number of characters written by an op of that kind.
+  static constexpr uint8_t MaxWidth(OpKind kind, char arg) {
+    switch (kind) {
+      case kLiteral:
+      case kWeekdayMonday1:
+      case kWeekdaySunday0:
+        return 1;
+      case kYear2:
+      case kMonth:
+      case kDay:
+      case kDaySpacePadded:
+      case kHour:
+      case kHour12:
+      case kAmPm:
+      case kMinute:
+      case kSecond:
+        return 2;
+      case kDayOfYear:
+      case kWeekdayShort:
+      case kMonthShort:
+        return 3;
+      case kOffset:
+        return 5;
+      case kYear:
+      case kOffsetColon:
+        return 6;
+      case kWeekdayLong:
+      case kMonthLong:
+        return 9;
+      case kFraction:
+        return arg;
+    }
+    return 0;
+  }
+
+  constexpr void add(OpKind kind, char arg = 0) {
+    if (op_count_ == kMaxOps) {
+      ok_ = false;
+      return;
+    }
+    ops_[op_count_++] = Op{kind, arg};
+    max_length_ += MaxWidth(kind, arg);
+  }
+
+  constexpr void compile(const char* p) {
+    while (*p != '\0' && ok_) {
+      if (*p != '%') {
+        add(kLiteral, *p++);
+        continue;
+      }
+      ++p;
+      char digits = 6;
+      if (*p >= '1' && *p <= '6') {
+        digits = *p++ - '0';
+        if (*p != 'f') {
+          ok_ = false;
+          return;
+        }
+      }
+      if (*p == ':') {
+        ++p;
+        if (*p != 'z') {
+          ok_ = false;
+          return;
+        }
+        add(kOffsetColon);
+        ++p;
+        continue;
+      }
+      switch (*p++) {
+        case 'Y': add(kYear); break;
+        case 'y': add(kYear2); break;
+        case 'm': add(kMonth); break;
+        case 'd': add(kDay); break;
+        case 'e': add(kDaySpacePadded); break;
+        case 'j': add(kDayOfYear); break;
+        case 'H': add(kHour); break;
+        case 'I': add(kHour12); break;
+        case 'p': add(kAmPm); break;
+        case 'M': add(kMinute); break;
+        case 'S': add(kSecond); break;
+        case 'f': add(kFraction, digits); break;
+        case 'a': add(kWeekdayShort); break;
+        case 'A': add(kWeekdayLong); break;
+        case 'u': add(kWeekdayMonday1); break;
+        case 'w': add(kWeekdaySunday0); break;
+        case 'b':
+        case 'h': add(kMonthShort); break;
+        case 'B': add(kMonthLong); break;
+        case 'z': add(kOffset); break;
+        case 'F': compile("%Y-%m-%d"); break;
+        case 'T': compile("%H:%M:%S"); break;
+        case 'R': compile("%H:%M"); break;
+        case 'D': compile("%m/%d/%y"); break;
+        case '%': add(kLiteral, '%'); break;
+        default: {
+          // Unsupported conversion, or '%' at the end of the pattern.
+          ok_ = false;
+          return;
+        }
+      }
+    }
+  }
+
+  Op ops_[kMaxOps];
+  uint8_t op_count_;
+  uint16_t max_length_;
+  bool ok_;
+};
+
+}  // namespace roo_time
@@ -0,0 +1,207 @@
+#include "roo_time/duration_format.h"
+
+#include <string.h>
+
+#include "roo_time/internal/digits.h"
+
+namespace roo_time {
+
+namespace {
+
+constexpr uint64_t kPow10[] = {1ULL,
+                               10ULL,
+                               100ULL,
+                               1000ULL,
+                               10000ULL,
+                               100000ULL,
+                               1000000ULL,
+                               10000000ULL,
+                               100000000ULL,
+                               1000000000ULL,
+                               10000000000ULL,
+                               100000000000ULL,
+                               1000000000000ULL,
+                               10000000000000ULL,
+                               100000000000000ULL,
+                               1000000000000000ULL,
+                               10000000000000000ULL,
+                               100000000000000000ULL};
+
+// Maximum number of significant fractional digits. Keeps the fraction below
+// 10^17, so that scaling it by the largest unit multiplier (36, for hours)
+// cannot overflow.
+constexpr int kMaxFractionDigits = 17;
+
+// A unit suffix, worth `multiplier` * 10^`exponent` microseconds.
+struct Unit {
+  const char* name;
+  uint8_t length;
+  int8_t exponent;
+  uint8_t multiplier;
+};
+
+constexpr Unit kUnits[] = {
+    {"ns", 2, -3, 1},       {"us", 2, 0, 1},  {"\xC2\xB5s", 3, 0, 1},
+    {"\xCE\xBCs", 3, 0, 1}, {"ms", 2, 3, 1},  {"s", 1, 6, 1},
+    {"m", 1, 7, 6},         {"h", 1, 8, 36},
+};
+
+bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+const Unit* FindUnit(const char* str, size_t len) {
+  for (const Unit& unit : kUnits) {
+    if (unit.length == len && memcmp(unit.name, str, len) == 0) return &unit;
+  }
+  return nullptr;
+}
+
+// Writes the fraction `micros` / 10^6, if nonzero, as a decimal point
+// followed by up to 6 digits, without trailing zeros. Returns the end
+// pointer.
+char* WriteFraction(char* p, uint32_t micros) {
+  if (micros == 0) return p;
+  *p++ = '.';
+  char digits[6];
+  internal::write_6_digits(digits, micros);
+  int n = 6;
+  while (digits[n - 1] == '0') --n;
+  memcpy(p, digits, n);
+  return p + n;
+}
+
+}  // namespace
+
+size_t FormatDuration(Duration d, char* buf, size_t size) {
+  char tmp[kDurationMaxLength];
+  char* p = tmp;
+  int64_t micros = d.inMicros();
+  // Computed in unsigned arithmetic, so that the minimum value does not
+  // overflow.
+  uint64_t magnitude = (uint64_t)micros;
+  if (micros < 0) {
+    *p++ = '-';
+    magnitude = 0 - magnitude;
+  }
+  if (magnitude == 0) {
+    *p++ = '0';
+    *p++ = 's';
+  } else if (magnitude < 1000) {
+    p = internal::write_decimal(p, magnitude);
+    *p++ = 'u';
+    *p++ = 's';
+  } else if (magnitude < 1000000) {
+    p = internal::write_decimal(p, magnitude / 1000);
+    p = WriteFraction(p, (magnitude % 1000) * 1000);
+    *p++ = 'm';
+    *p++ = 's';
+  } else {
+    uint64_t seconds = magnitude / 1000000;
+    // At most 2562047788, which fits in 32 bits.
+    uint32_t hours = seconds / 3600;
+    uint32_t rem = seconds % 3600;
+    if (hours > 0) {
+      p = internal::write_decimal(p, hours);
+      *p++ = 'h';
+    }
+    if (hours > 0 || rem >= 60) {
+      p = internal::write_decimal(p, rem / 60);
+      *p++ = 'm';
+    }
+    p = internal::write_decimal(p, rem % 60);
+    p = WriteFraction(p, magnitude % 1000000);
+    *p++ = 's';
+  }
+  size_t len = p - tmp;
+  if (len >= size) {
+    if (size > 0) buf[0] = '\0';
+    return 0;
+  }
+  memcpy(buf, tmp, len);
+  buf[len] = '\0';
+  return len;
+}
+
+bool ParseDuration(const char* str, size_t len, Duration* result) {
+  const char* p = str;
+  const char* end = str + len;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = (*p == '-');
+    ++p;
+  }
+  if (p == end) return false;
+  if (end - p == 1 && *p == '0') {
+    *result = Duration();
+    return true;
+  }
+  // The magnitude of INT64_MIN is one more than INT64_MAX.
+  const uint64_t limit = negative ? (1ULL << 63) : (1ULL << 63) - 1;
+  uint64_t total = 0;
+  while (p < end) {
+    // Integer part.
+    const char* start = p;
+    uint64_t integer = 0;
+    for (; p < end && IsDigit(*p); ++p) {
+      if (__builtin_mul_overflow(integer, 10, &integer) ||
+          __builtin_add_overflow(integer, *p - '0', &integer)) {
+        return false;
+      }
+    }
+    bool has_integer = (p != start);
+    // Fraction.
+    uint64_t fraction = 0;
+    int fraction_digits = 0;
+    bool has_fraction = false;
+    if (p < end && *p == '.') {
+      ++p;
+      start = p;
+      for (; p < end && IsDigit(*p); ++p) {
+        if (fraction_digits < kMaxFractionDigits) {
+          fraction = fraction * 10 + (*p - '0');
+          ++fraction_digits;
+        }
+      }
+      has_fraction = (p != start);
+    }
+    if (!has_integer && !has_fraction) return false;
+    // Unit.
+    start = p;
+    while (p < end && !IsDigit(*p) && *p != '.') ++p;
+    const Unit* unit = FindUnit(start, p - start);
+    if (unit == nullptr) return false;
+    uint64_t micros;
+    if (unit->exponent < 0) {
+      // Sub-microsecond unit; the fraction contributes less than 1us.
+      micros = integer / kPow10[-unit->exponent];
+    } else {
+      if (__builtin_mul_overflow(
+              integer, unit->multiplier * kPow10[unit->exponent], &micros)) {
+        return false;
+      }
+      // fraction / 10^fraction_digits * multiplier * 10^exponent, truncated.
+      int e = unit->exponent - fraction_digits;
+      uint64_t fraction_micros;
+      if (e >= 0) {
+        fraction_micros = fraction * unit->multiplier * kPow10[e];
+      } else {
+        uint64_t divisor = kPow10[-e];
+        fraction_micros = (fraction / divisor) * unit->multiplier +
+                          (fraction % divisor) * unit->multiplier / divisor;
+      }
+      if (__builtin_add_overflow(micros, fraction_micros, &micros)) {
+        return false;
+      }
+    }
+    if (__builtin_add_overflow(total, micros, &total) || total > limit) {
+      return false;
+    }
+  }
+  *result = Micros(negative ? -(int64_t)(total - 1) - 1 : (int64_t)total);
+  return true;
+}
+
+bool ParseDuration(const char* str, Duration* result) {
+  return ParseDuration(str, strlen(str), result);
+}
+
+}  // namespace roo_time
@@ -0,0 +1,57 @@
+#pragma once
+
+/// Human-readable duration strings, e.g. "1h30m5.25s", as used by Go's
+/// `time.ParseDuration()` and `time.Duration.String()`.
+///
+/// Does not allocate, so it is suitable for parsing configuration files and
+/// command-line flags on microcontrollers.
+
+#include <stddef.h>
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Maximum length of a formatted duration, excluding the terminating NUL,
+/// e.g. "-1000000000h59m59.999999s".
+constexpr size_t kDurationMaxLength = 25;
+
+/// Buffer size sufficient for any formatted duration.
+constexpr size_t kDurationBufferSize = kDurationMaxLength + 1;
+
+/// Writes `d` as a NUL-terminated string into `buf`, which has room for `size`
+/// characters, in the format produced by Go's `time.Duration.String()`.
+///
+/// Durations of one second or more are written as hours, minutes, and
+/// seconds, with leading zero units omitted, and with the fraction of the
+/// second trimmed of trailing zeros, e.g. "1h0m0s", "1m30s", or "2.5s".
+/// Shorter durations use the largest unit that keeps the integer part
+/// nonzero, e.g. "250ms" or "1.5ms", or "17us". (Unlike Go, microseconds are
+/// written as "us" rather than "µs", to keep the output ASCII.) Zero is
+/// written as "0s".
+///
+/// Returns the length of the string, excluding the terminating NUL. If the
+/// string does not fit, writes an empty string (if `size` > 0) and returns 0.
+size_t FormatDuration(Duration d, char* buf, size_t size);
+
+/// Parses a duration string from the `len` characters at `str` (which need
+/// not be NUL-terminated).
+///
+/// The string is an optional sign followed by a sequence of decimal numbers,
+/// each with an optional fraction and a mandatory unit suffix, e.g. "300ms",
+/// "-1.5h", or "2h45m". Valid units are "ns", "us" (or "µs", "μs"), "ms", "s",
+/// "m", and "h". A lone "0" is also accepted.
+///
+/// The result is exact to the microsecond: each number's contribution is
+/// truncated toward zero, so e.g. "1500ns" parses as 1us. Fractional digits
+/// beyond the 17th are ignored.
+///
+/// On success, stores the duration in `result` and returns true. Returns
+/// false, leaving `result` unchanged, if the input is malformed, or if the
+/// duration is out of the range of `Duration`.
+bool ParseDuration(const char* str, size_t len, Duration* result);
+
+/// As above, for a NUL-terminated string.
+bool ParseDuration(const char* str, Duration* result);
+
+}  // namespace roo_time
@@ -0,0 +1,147 @@
+#include "roo_time/format.h"
+
+#include <string.h>
+
+#include "roo_time/batch.h"
+#include "roo_time/internal/calendar.h"
+#include "roo_time/internal/digits.h"
+
+namespace roo_time {
+
+namespace {
+
+constexpr int64_t kMicrosPerDay = 24LL * 3600 * 1000000;
+
+// Number of timestamps decomposed at a time by the bulk formatter.
+constexpr size_t kBlockSize = 64;
+
+// Writes the timestamp into `p`, which must have room for kRfc3339MaxLength
+// characters. Returns the end pointer. Does not write the terminating NUL.
+char* WriteRfc3339(char* p, int16_t year, uint8_t month, uint8_t day,
+                   uint8_t hour, uint8_t minute, uint8_t second,
+                   uint32_t micros, int32_t offset_minutes,
+                   const Rfc3339Options& options) {
+  p = internal::write_iso_year(p, year);
+  *p++ = '-';
+  p = internal::write_2_digits(p, month);
+  *p++ = '-';
+  p = internal::write_2_digits(p, day);
+  *p++ = 'T';
+  p = internal::write_2_digits(p, hour);
+  *p++ = ':';
+  p = internal::write_2_digits(p, minute);
+  *p++ = ':';
+  p = internal::write_2_digits(p, second);
+  uint8_t digits = options.fraction_digits;
+  if (digits > 0) {
+    if (digits > 6) digits = 6;
+    char fraction[6];
+    internal::write_6_digits(fraction, micros);
+    *p++ = '.';
+    memcpy(p, fraction, digits);
+    p += digits;
+  }
+  if (offset_minutes == 0 && options.zero_offset == Rfc3339Options::kZulu) {
+    *p++ = 'Z';
+    return p;
+  }
+  return internal::write_utc_offset(p, offset_minutes, true);
+}
+
+// Writes an empty string to `buf`, if it has room for it. Returns 0.
+size_t Fail(char* buf, size_t size) {
+  if (size > 0) buf[0] = '\0';
+  return 0;
+}
+
+// Finishes the string written at `dst`, which is either `buf`, if it is large
+// enough for any timestamp, or a temporary buffer. In the latter case, copies
+// the string to `buf`, if it fits.
+size_t Finish(char* dst, char* end, char* buf, size_t size) {
+  size_t len = end - dst;
+  if (dst == buf) {
+    *end = '\0';
+    return len;
+  }
+  if (len >= size) return Fail(buf, size);
+  memcpy(buf, dst, len);
+  buf[len] = '\0';
+  return len;
+}
+
+}  // namespace
+
+size_t FormatRfc3339(const DateTime& dt, char* buf, size_t size,
+                     Rfc3339Options options) {
+  int32_t offset_minutes = dt.timeZone().offset().inMinutes();
+  if (!internal::utc_offset_fits(offset_minutes)) return Fail(buf, size);
+  char tmp[kRfc3339BufferSize];
+  char* dst = (size >= kRfc3339BufferSize) ? buf : tmp;
+  char* end = WriteRfc3339(dst, dt.year(), dt.month(), dt.day(), dt.hour(),
+                           dt.minute(), dt.second(), dt.micros(),
+                           offset_minutes, options);
+  return Finish(dst, end, buf, size);
+}
+
+size_t FormatRfc3339(WallTime t, TimeZone tz, char* buf, size_t size,
+                     Rfc3339Options options) {
+  int32_t offset_minutes = tz.offset().inMinutes();
+  if (!internal::utc_offset_fits(offset_minutes)) return Fail(buf, size);
+  int64_t local = (t.sinceEpoch() + tz.offset()).inMicros();
+  int32_t days = internal::floor_div(local, kMicrosPerDay);
+  uint64_t since_midnight = local - (int64_t)days * kMicrosPerDay;
+  uint32_t seconds = since_midnight / 1000000;
+  int16_t year;
+  uint8_t month;
+  uint8_t day;
+  internal::civil_from_days(days, &year, &month, &day);
+  char tmp[kRfc3339BufferSize];
+  char* dst = (size >= kRfc3339BufferSize) ? buf : tmp;
+  char* end = WriteRfc3339(dst, year, month, day, seconds / 3600,
+                           (seconds / 60) % 60, seconds % 60,
+                           since_midnight % 1000000, offset_minutes, options);
+  return Finish(dst, end, buf, size);
+}
+
+size_t FormatRfc3339(const WallTime* wall_times, size_t count, TimeZone tz,
+                     char* out, size_t stride, Rfc3339Options options) {
+  int16_t year[kBlockSize];
+  uint8_t month[kBlockSize];
+  uint8_t day[kBlockSize];
+  uint8_t hour[kBlockSize];
+  uint8_t minute[kBlockSize];
+  uint8_t second[kBlockSize];
+  uint32_t micros[kBlockSize];
+  CivilColumns columns;
+  columns.year = year;
+  columns.month = month;
+  columns.day = day;
+  columns.hour = hour;
+  columns.minute = minute;
+  columns.second = second;
+  columns.micros = micros;
+  int32_t offset_minutes = tz.offset().inMinutes();
+  if (!internal::utc_offset_fits(offset_minutes)) {
+    for (size_t i = 0; i < count; ++i) Fail(out + i * stride, stride);
+    return 0;
+  }
+  size_t written = 0;
+  char tmp[kRfc3339BufferSize];
+  char* dst = (stride >= kRfc3339BufferSize) ? nullptr : tmp;
+  for (size_t pos = 0; pos < count; pos += kBlockSize) {
+    size_t n = count - pos;
+    if (n > kBlockSize) n = kBlockSize;
+    DecomposeWallTimes(wall_times + pos, n, tz, columns);
+    for (size_t i = 0; i < n; ++i) {
+      char* buf = out + (pos + i) * stride;
+      char* d = (dst == nullptr) ? buf : dst;
+      char* end = WriteRfc3339(d, year[i], month[i], day[i], hour[i],
+                               minute[i], second[i], micros[i],
+                               offset_minutes, options);
+      if (Finish(d, end, buf, stride) > 0) ++written;
+    }
+  }
+  return written;
+}
+
+}  // namespace roo_time
@@ -0,0 +1,70 @@
+#pragma once
+
+/// RFC 3339 (ISO 8601) formatting into caller-provided buffers.
+///
+/// Does not allocate, and does not depend on stdio or iostreams, so it is
+/// usable on microcontrollers.
+
+#include <stddef.h>
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Options for `FormatRfc3339()`.
+struct Rfc3339Options {
+  /// How the UTC offset is written when it is zero.
+  enum ZeroOffset : uint8_t {
+    /// As "Z", e.g. "2024-07-01T12:00:00Z".
+    kZulu,
+
+    /// As "+00:00", e.g. "2024-07-01T12:00:00+00:00".
+    kNumeric,
+  };
+
+  /// Number of fractional second digits, in [0, 6]. The fraction is
+  /// truncated, not rounded. When 0, the fraction is omitted altogether.
+  uint8_t fraction_digits = 0;
+
+  ZeroOffset zero_offset = kZulu;
+};
+
+/// Maximum length of a formatted timestamp, excluding the terminating NUL,
+/// e.g. "-32768-01-01T00:00:00.000000+00:00".
+constexpr size_t kRfc3339MaxLength = 34;
+
+/// Buffer size sufficient for any formatted timestamp.
+constexpr size_t kRfc3339BufferSize = kRfc3339MaxLength + 1;
+
+/// Writes `dt` in RFC 3339 format, e.g. "2024-07-01T14:00:00.250+02:00", as a
+/// NUL-terminated string into `buf`, which has room for `size` characters.
+///
+/// Years outside [0, 9999], which RFC 3339 does not support, are written in
+/// the ISO 8601 expanded form, e.g. "-0044" or "+12345".
+///
+/// Returns the length of the string, excluding the terminating NUL. If the
+/// string does not fit, or the UTC offset is 100 hours or more (which RFC 3339
+/// cannot represent, and no real time zone has), writes an empty string (if
+/// `size` > 0) and returns 0.
+size_t FormatRfc3339(const DateTime& dt, char* buf, size_t size,
+                     Rfc3339Options options = Rfc3339Options());
+
+/// Writes `t`, in time zone `tz`, in RFC 3339 format. Equivalent to
+/// `FormatRfc3339(DateTime(t, tz), ...)`, but faster, as it only derives the
+/// fields that are printed.
+size_t FormatRfc3339(WallTime t, TimeZone tz, char* buf, size_t size,
+                     Rfc3339Options options = Rfc3339Options());
+
+/// Writes `count` wall times, in time zone `tz`, in RFC 3339 format. The i-th
+/// timestamp is written as a NUL-terminated string at `out + i * stride`,
+/// with room for `stride` characters. Timestamps that do not fit are written
+/// as empty strings.
+///
+/// Decomposes the input in blocks, using `DecomposeWallTimes()`.
+///
+/// Returns the number of timestamps that fit.
+size_t FormatRfc3339(const WallTime* wall_times, size_t count, TimeZone tz,
+                     char* out, size_t stride,
+                     Rfc3339Options options = Rfc3339Options());
+
+}  // namespace roo_time
@@ -0,0 +1,199 @@
+#pragma once
+
+/// Internal civil-calendar helpers shared by the roo_time headers and
+/// translation units.
+///
+/// Not part of the public API. All functions are constexpr, and operate on
+/// plain integers, so that this header does not depend on `roo_time.h`.
+
+#include <inttypes.h>
+
+namespace roo_time {
+namespace internal {
+
+// Selects the calendar algorithms used by days_from_civil() and
+// civil_from_days(). When 0 (the default), uses the division-free
+// Neri-Schneider algorithms. When 1, uses the classic Hinnant algorithms, which
+// perform several 32-bit divisions per call. Both produce identical results
+// over the supported range.
+#ifndef ROO_TIME_CALENDAR_HINNANT
+#define ROO_TIME_CALENDAR_HINNANT 0
+#endif
+
+// Credit:
+// https://stackoverflow.com/questions/7960318/math-to-convert-seconds-since-1970-into-date-and-vice-versa
+
+// Returns number of days since civil 1970-01-01.  Negative values indicate
+//    days prior to 1970-01-01.
+// Preconditions:  y-m-d represents a date in the civil (Gregorian) calendar
+//                 m is in [1, 12]
+//                 d is in [1, last_day_of_month(y, m)]
+//                 y is "approximately" in
+//                   [numeric_limits<Int>::min()/366,
+//                   numeric_limits<Int>::max()/366]
+//                 Exact range of validity is:
+//                 [civil_from_days(numeric_limits<Int>::min()),
+//                  civil_from_days(numeric_limits<Int>::max()-719468)]
+constexpr int32_t days_from_civil_hinnant(int32_t y, uint8_t m,
+                                          uint8_t d) noexcept {
+  y -= m <= 2;
+  const int32_t era = (y >= 0 ? y : y - 399) / 400;
+  const uint32_t yoe = static_cast<uint16_t>(y - era * 400);  // [0, 399]
+  const uint32_t doy =
+      (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;          // [0, 365]
+  const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;  // [0, 146096]
+  return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+// Returns year/month/day triple in civil calendar
+// Preconditions:  z is number of days since 1970-01-01 and is in the range:
+//                   [numeric_limits<Int>::min(),
+//                   numeric_limits<Int>::max()-719468].
+constexpr void civil_from_days_hinnant(int32_t z, int16_t* year,
+                                       uint8_t* month, uint8_t* day) noexcept {
+  z += 719468;
+  const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const uint32_t doe = static_cast<uint32_t>(z - era * 146097);  // [0, 146096]
+  const uint32_t yoe =
+      (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;  // [0, 399]
+  const int32_t y = static_cast<int32_t>(yoe) + era * 400;
+  const uint16_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);  // [0, 365]
+  const uint8_t mp = (5 * doy + 2) / 153;                        // [0, 11]
+  const uint8_t d = doy - (153 * mp + 2) / 5 + 1;                // [1, 31]
+  const uint8_t m = mp + (mp < 10 ? 3 : -9);                     // [1, 12]
+  *year = y + (m <= 2);
+  *month = m;
+  *day = d;
+}
+
+// Credit:
+// C. Neri and L. Schneider, "Euclidean affine functions and their application
+// to calendar algorithms", Softw Pract Exper. 2023;53(4):937-970.
+//
+// The algorithms operate on unsigned 32-bit values; the only divisions are by
+// constants, and compile to multiplications and shifts. Dates are shifted by
+// kNsEras 400-year eras, so that all intermediate values are non-negative for
+// every year representable as int16_t.
+
+constexpr uint32_t kNsEras = 82;
+constexpr uint32_t kNsYearShift = 400 * kNsEras;
+constexpr uint32_t kNsDayShift = 719468 + 146097 * kNsEras;
+
+// Returns number of days since civil 1970-01-01, like days_from_civil_hinnant.
+// Preconditions:  y-m-d represents a date in the civil (Gregorian) calendar
+//                 m is in [1, 12]
+//                 d is in [1, last_day_of_month(y, m)]
+//                 y is in [-32799, 32767]
+constexpr int32_t days_from_civil_neri_schneider(int32_t y, uint8_t m,
+                                                 uint8_t d) noexcept {
+  const uint32_t j = m <= 2;
+  const uint32_t yy = static_cast<uint32_t>(y) + kNsYearShift - j;
+  const uint32_t mm = j ? m + 12 : m;
+  const uint32_t dd = d - 1;
+  const uint32_t c = yy / 100;
+  const uint32_t y_star = 1461 * yy / 4 - c + c / 4;
+  const uint32_t m_star = (979 * mm - 2919) / 32;
+  const uint32_t n = y_star + m_star + dd;
+  return static_cast<int32_t>(n - kNsDayShift);
+}
+
+// Returns year/month/day triple in civil calendar, like
+// civil_from_days_hinnant.
+// Preconditions:  z is number of days since 1970-01-01, and the resulting
+//                 year is in [-32799, 32767].
+constexpr void civil_from_days_neri_schneider(int32_t z, int16_t* year,
+                                              uint8_t* month,
+                                              uint8_t* day) noexcept {
+  const uint32_t n = static_cast<uint32_t>(z) + kNsDayShift;
+  // Century.
+  const uint32_t n1 = 4 * n + 3;
+  const uint32_t c = n1 / 146097;
+  const uint32_t nc = n1 % 146097 / 4;
+  // Year.
+  const uint32_t n2 = 4 * nc + 3;
+  const uint64_t p2 = static_cast<uint64_t>(2939745) * n2;
+  const uint32_t z2 = static_cast<uint32_t>(p2 >> 32);
+  const uint32_t ny = static_cast<uint32_t>(p2) / 2939745 / 4;
+  const uint32_t y = 100 * c + z2;
+  // Month and day.
+  const uint32_t n3 = 2141 * ny + 197913;
+  const uint32_t m = n3 >> 16;
+  const uint32_t d = (n3 & 0xFFFF) / 2141;
+  // Map from the computational (March-based) calendar to the civil one.
+  const uint32_t j = ny >= 306;
+  *year = static_cast<int16_t>(y - kNsYearShift + j);
+  *month = j ? m - 12 : m;
+  *day = d + 1;
+}
+
+// Returns number of days since civil 1970-01-01.  Negative values indicate
+//    days prior to 1970-01-01.
+// Preconditions:  y-m-d represents a date in the civil (Gregorian) calendar
+//                 m is in [1, 12]
+//                 d is in [1, last_day_of_month(y, m)]
+//                 y is in [-32768, 32767]
+constexpr int32_t days_from_civil(int32_t y, uint8_t m, uint8_t d) noexcept {
+#if ROO_TIME_CALENDAR_HINNANT
+  return days_from_civil_hinnant(y, m, d);
+#else
+  return days_from_civil_neri_schneider(y, m, d);
+#endif
+}
+
+// Returns year/month/day triple in civil calendar
+// Preconditions:  z is number of days since 1970-01-01, and the resulting
+//                 year is in [-32768, 32767].
+constexpr void civil_from_days(int32_t z, int16_t* year, uint8_t* month,
+                               uint8_t* day) noexcept {
+#if ROO_TIME_CALENDAR_HINNANT
+  civil_from_days_hinnant(z, year, month, day);
+#else
+  civil_from_days_neri_schneider(z, year, month, day);
+#endif
+}
+
+// Returns day of week in civil calendar [0, 6] -> [Sun, Sat]
+// Preconditions:  z is number of days since 1970-01-01 and is in the range:
+//                   [numeric_limits<Int>::min(), numeric_limits<Int>::max()-4].
+constexpr uint8_t weekday_from_days(int32_t z) noexcept {
+  return z >= -4 ? (z + 4) % 7 : (z + 5) % 7 + 6;
+}
+
+// Returns: true if y is a leap year in the civil calendar, else false
+constexpr bool is_leap(int32_t y) noexcept {
+  return y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+}
+
+// Returns the number of days in the month m of year y, in [28, 31].
+// Preconditions:  m is in [1, 12]
+constexpr uint8_t last_day_of_month(int32_t y, uint8_t m) noexcept {
+  return m != 2 ? ((m ^ (m >> 3)) & 1) | 30 : (is_leap(y) ? 29 : 28);
+}
+
+// Preconditions:  y-m-d represents a date in the civil (Gregorian) calendar
+//                 m is in [1, 12]
+//                 d is in [1, last_day_of_month(y, m)]
+constexpr uint16_t day_of_year(int16_t y, uint8_t m, uint8_t d) {
+  constexpr uint16_t days_to_month[12] = {0,   31,  59,  90,  120, 151,
+                                          181, 212, 243, 273, 304, 334};
+  uint16_t result = days_to_month[m - 1] + d;
+  if (m > 2 && is_leap(y)) result++;
+  return result;
+}
+
+// Credit:
+// https://stackoverflow.com/questions/1082917/mod-of-negative-number-is-melting-my-brain/1082938#1082938
+// Assumes n > 0.
+template <typename Int>
+constexpr Int floor_mod(Int k, Int n) {
+  return ((k %= n) < 0) ? k + n : k;
+}
+
+// Returns k / n, rounded towards negative infinity. Assumes n > 0.
+template <typename Int>
+constexpr Int floor_div(Int k, Int n) {
+  return (k % n < 0) ? k / n - 1 : k / n;
+}
+
+}  // namespace internal
+}  // namespace roo_time
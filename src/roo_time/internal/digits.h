@@ -0,0 +1,104 @@
+#pragma once
+
+/// Internal decimal-formatting helpers shared by the roo_time formatters.
+///
+/// Not part of the public API. Functions write fixed numbers of digits without
+/// bounds checks; callers are responsible for providing enough room.
+
+#include <inttypes.h>
+
+namespace roo_time {
+namespace internal {
+
+// Two-character decimal representations of 00..99, concatenated.
+inline constexpr char kDigitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Writes v, which must be in [0, 99], as two digits. Returns the end pointer.
+inline char* write_2_digits(char* p, uint32_t v) {
+  const char* pair = &kDigitPairs[2 * v];
+  p[0] = pair[0];
+  p[1] = pair[1];
+  return p + 2;
+}
+
+// Writes v, which must be in [0, 9999], as four digits. Returns the end
+// pointer.
+inline char* write_4_digits(char* p, uint32_t v) {
+  p = write_2_digits(p, v / 100);
+  return write_2_digits(p, v % 100);
+}
+
+// Writes v, which must be in [0, 999999], as six digits. Returns the end
+// pointer.
+inline char* write_6_digits(char* p, uint32_t v) {
+  p = write_2_digits(p, v / 10000);
+  p = write_2_digits(p, (v / 100) % 100);
+  return write_2_digits(p, v % 100);
+}
+
+// Writes v in decimal, without leading zeros. Returns the end pointer.
+inline char* write_decimal(char* p, uint32_t v) {
+  char tmp[10];
+  char* end = tmp + sizeof(tmp);
+  char* q = end;
+  while (v >= 100) {
+    q -= 2;
+    write_2_digits(q, v % 100);
+    v /= 100;
+  }
+  if (v >= 10) {
+    q -= 2;
+    write_2_digits(q, v);
+  } else {
+    *--q = '0' + v;
+  }
+  while (q < end) *p++ = *q++;
+  return p;
+}
+
+// Writes the year as four digits, if it is in [0, 9999], or otherwise in the
+// ISO 8601 expanded form: a sign followed by at least four digits. Writes at
+// most 6 characters. Returns the end pointer.
+inline char* write_iso_year(char* p, int16_t year) {
+  if (year >= 0 && year <= 9999) return write_4_digits(p, year);
+  int32_t y = year;
+  *p++ = (y < 0) ? '-' : '+';
+  if (y < 0) y = -y;
+  return (y <= 9999) ? write_4_digits(p, y) : write_decimal(p, y);
+}
+
+// Largest UTC offset, in minutes, that fits in the "+hh:mm" form.
+constexpr int32_t kMaxUtcOffsetMinutes = 99 * 60 + 59;
+
+// Returns true if the UTC offset, in minutes, fits in the "+hh:mm" form.
+constexpr bool utc_offset_fits(int32_t minutes) {
+  return minutes >= -kMaxUtcOffsetMinutes && minutes <= kMaxUtcOffsetMinutes;
+}
+
+// Writes a UTC offset, in minutes, for which utc_offset_fits() must hold, as a
+// sign, two digits of hours, an optional colon, and two digits of minutes,
+// e.g. "+05:30". Writes at most 6 characters. Returns the end pointer.
+inline char* write_utc_offset(char* p, int32_t minutes, bool colon) {
+  if (minutes < 0) {
+    *p++ = '-';
+    minutes = -minutes;
+  } else {
+    *p++ = '+';
+  }
+  p = write_2_digits(p, minutes / 60);
+  if (colon) *p++ = ':';
+  return write_2_digits(p, minutes % 60);
+}
+
+}  // namespace internal
+}  // namespace roo_time
@@ -0,0 +1,114 @@
+#pragma once
+
+/// Internal helpers for dividing 64-bit microsecond counts by the constant
+/// unit sizes (ms, s, min, h).
+///
+/// Not part of the public API. On 32-bit targets, a 64-bit division compiles
+/// to a runtime library call (e.g. `__divdi3`, `__aeabi_ldivmod`), which takes
+/// hundreds of cycles on cores without a 64-bit divider. The helpers below
+/// divide instead by multiplying with a precomputed reciprocal (Granlund and
+/// Montgomery, "Division by Invariant Integers using Multiplication"), which
+/// is exact for the full `int64_t` range.
+
+#include <inttypes.h>
+#include <stdint.h>
+
+// Selects how durations are converted to coarser units. When 1, divisions by
+// the unit sizes use multiplication by a reciprocal. When 0, they use the
+// division operator. Defaults to 1 on 32-bit targets; 64-bit compilers
+// already strength-reduce division by a constant.
+#ifndef ROO_TIME_RECIPROCAL_DIVISION
+#if UINTPTR_MAX == 0xFFFFFFFF
+#define ROO_TIME_RECIPROCAL_DIVISION 1
+#else
+#define ROO_TIME_RECIPROCAL_DIVISION 0
+#endif
+#endif
+
+namespace roo_time {
+namespace internal {
+
+// Returns the high 64 bits of the 128-bit product a * b, computed from four
+// 32x32->64 partial products. Used when 128-bit integers are not available.
+constexpr uint64_t mulhi64_32(uint64_t a, uint64_t b) {
+  uint64_t a_lo = (uint32_t)a;
+  uint64_t a_hi = a >> 32;
+  uint64_t b_lo = (uint32_t)b;
+  uint64_t b_hi = b >> 32;
+  uint64_t lo_lo = a_lo * b_lo;
+  uint64_t hi_lo = a_hi * b_lo;
+  uint64_t lo_hi = a_lo * b_hi;
+  uint64_t hi_hi = a_hi * b_hi;
+  // Cannot overflow: at most (2^32 - 1)^2 + 2 * (2^32 - 1) = 2^64 - 1.
+  uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+  return hi_hi + (hi_lo >> 32) + (cross >> 32);
+}
+
+// Returns the high 64 bits of the 128-bit product a * b.
+constexpr uint64_t mulhi64(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#else
+  return mulhi64_32(a, b);
+#endif
+}
+
+// Reciprocal of a divisor d = d' * 2^kPreShift, with d' odd. The dividend is
+// first shifted right by kPreShift, which leaves enough headroom for a magic
+// number that fits in 64 bits: for u < 2^(64 - kPreShift),
+// floor(u / d) = mulhi64(u >> kPreShift, kMagic) >> kPostShift.
+template <uint64_t kDivisor>
+struct Reciprocal;
+
+template <>
+struct Reciprocal<1000ULL> {
+  static constexpr int kPreShift = 3;
+  static constexpr uint64_t kMagic = 0x20C49BA5E353F7CFULL;
+  static constexpr int kPostShift = 4;
+};
+
+template <>
+struct Reciprocal<1000000ULL> {
+  static constexpr int kPreShift = 6;
+  static constexpr uint64_t kMagic = 0x0431BDE82D7B634EULL;
+  static constexpr int kPostShift = 8;
+};
+
+template <>
+struct Reciprocal<60000000ULL> {
+  static constexpr int kPreShift = 8;
+  static constexpr uint64_t kMagic = 0x011E54C672874DAFULL;
+  static constexpr int kPostShift = 10;
+};
+
+template <>
+struct Reciprocal<3600000000ULL> {
+  static constexpr int kPreShift = 10;
+  static constexpr uint64_t kMagic = 0x004C5ADF9601F295ULL;
+  static constexpr int kPostShift = 12;
+};
+
+// Returns n / kDivisor, rounded toward zero (like the division operator),
+// computed by multiplying with the reciprocal. Exact for all n.
+template <uint64_t kDivisor>
+constexpr int64_t div_by_reciprocal(int64_t n) {
+  using R = Reciprocal<kDivisor>;
+  // Magnitude in unsigned arithmetic, so that INT64_MIN does not overflow.
+  uint64_t u = (n < 0) ? 0 - (uint64_t)n : (uint64_t)n;
+  uint64_t q = mulhi64(u >> R::kPreShift, R::kMagic) >> R::kPostShift;
+  return (n < 0) ? -(int64_t)q : (int64_t)q;
+}
+
+// Returns n / kDivisor, rounded toward zero, using the method selected by
+// ROO_TIME_RECIPROCAL_DIVISION.
+template <uint64_t kDivisor>
+constexpr int64_t div_toward_zero(int64_t n) {
+#if ROO_TIME_RECIPROCAL_DIVISION
+  return div_by_reciprocal<kDivisor>(n);
+#else
+  return n / (int64_t)kDivisor;
+#endif
+}
+
+}  // namespace internal
+}  // namespace roo_time
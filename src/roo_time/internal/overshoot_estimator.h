@@ -0,0 +1,69 @@
+#pragma once
+
+/// Internal calibration of precise delays.
+///
+/// Not part of the public API. See `SetDelaySpinLimit()`.
+
+#include <atomic>
+#include <inttypes.h>
+#include <stdint.h>
+
+namespace roo_time {
+namespace internal {
+
+// Tracks how late sleeps wake up, to decide how long before a deadline to
+// stop sleeping and start busy-waiting.
+//
+// Keeps exponentially weighted moving averages of the overshoot and of its
+// mean deviation, in fixed point, the way TCP estimates round-trip times
+// (RFC 6298): the mean with gain 1/8, the deviation with gain 1/4. The lead
+// is the mean plus four deviations, which covers all but the rare outliers,
+// and adapts within a few samples when the scheduler's behavior changes
+// (e.g. under load).
+//
+// Safe to use from multiple threads: concurrent updates may occasionally
+// get lost, which only slows down the adaptation.
+class OvershootEstimator {
+ public:
+  // Cap on samples, so that an outlier (e.g. a preempted thread) does not
+  // throw the estimate off for long.
+  static constexpr int32_t kMaxSampleMicros = 100000;
+
+  constexpr OvershootEstimator() : mean8_(0), deviation4_(0) {}
+
+  // Records that a sleep woke up `overshoot_micros` after its target.
+  void update(int64_t overshoot_micros) {
+    if (overshoot_micros < 0) overshoot_micros = 0;
+    if (overshoot_micros > kMaxSampleMicros) {
+      overshoot_micros = kMaxSampleMicros;
+    }
+    int32_t sample = (int32_t)overshoot_micros;
+    int32_t mean8 = mean8_.load(std::memory_order_relaxed);
+    int32_t deviation4 = deviation4_.load(std::memory_order_relaxed);
+    int32_t error = sample - (mean8 >> 3);
+    mean8 += error;
+    if (error < 0) error = -error;
+    deviation4 += error - (deviation4 >> 2);
+    mean8_.store(mean8, std::memory_order_relaxed);
+    deviation4_.store(deviation4, std::memory_order_relaxed);
+  }
+
+  // Returns the estimated mean overshoot, in microseconds.
+  int32_t mean() const { return mean8_.load(std::memory_order_relaxed) >> 3; }
+
+  // Returns how long before a deadline to stop sleeping, in microseconds.
+  int32_t lead() const {
+    return (mean8_.load(std::memory_order_relaxed) >> 3) +
+           deviation4_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // 8x the mean overshoot, in microseconds.
+  std::atomic<int32_t> mean8_;
+
+  // 4x the mean deviation of the overshoot, in microseconds.
+  std::atomic<int32_t> deviation4_;
+};
+
+}  // namespace internal
+}  // namespace roo_time
@@ -0,0 +1,234 @@
+#pragma once
+
+/// Internal uptime source for Linux on x86-64, computed from the CPU's
+/// time-stamp counter (TSC), and calibrated against CLOCK_MONOTONIC.
+///
+/// Not part of the public API. Selected by compiling `uptime_now.cpp` with
+/// `ROO_TIME_LINUX_USE_TSC=1`.
+
+#if defined(__linux__) && defined(__x86_64__)
+
+#include <cpuid.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <time.h>
+#include <x86intrin.h>
+
+#include <atomic>
+
+#define ROO_TIME_TSC_CLOCK_AVAILABLE 1
+
+namespace roo_time {
+namespace internal {
+
+// Reads CLOCK_MONOTONIC, in microseconds. Served by the vDSO, i.e. without a
+// system call, and unaffected by NTP and manual clock changes.
+inline int64_t monotonic_micros() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Returns true if the TSC runs at a constant rate, regardless of frequency
+// scaling and sleep states (CPUID 0x80000007, EDX bit 8).
+inline bool has_invariant_tsc() {
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+  return (edx & (1u << 8)) != 0;
+}
+
+// Microsecond clock that follows CLOCK_MONOTONIC, but is read as
+// base + (TSC - anchor) * scale, i.e. with no more than a few loads, a
+// `rdtsc`, and a multiplication.
+//
+// The first reads, until the initial calibration completes (~10 ms), and all
+// reads on CPUs without an invariant TSC, fall back to CLOCK_MONOTONIC. Once
+// calibrated, the clock is recalibrated about once per second, by whichever
+// caller first notices that it is due. The scale is measured over the entire
+// lifetime of the clock, so it becomes increasingly precise; the base is
+// re-anchored at CLOCK_MONOTONIC, except that it never steps backwards: when
+// ahead, the clock slows down slightly instead, to catch up over the next
+// interval.
+//
+// Parameters are published through a two-slot sequence lock (a 'latch'):
+// readers retry only if an update completes while they read, and never wait
+// for a writer that got preempted. Returned values are monotone, up to the
+// (sub-microsecond) TSC skew between cores and the slew at recalibration.
+//
+// Constant-initialized, so that it is safe to use from static initializers.
+class TscClock {
+ public:
+  constexpr TscClock()
+      : seq_(0),
+        slots_(),
+        updating_(false),
+        disabled_(false),
+        calibration_started_(false),
+        calibration_tsc_(0),
+        calibration_micros_(0) {}
+
+  // Returns the current time, in microseconds, on the CLOCK_MONOTONIC scale.
+  int64_t now() {
+    while (true) {
+      uint32_t seq = seq_.load(std::memory_order_acquire);
+      const Slot& slot = slots_[seq & 1];
+      uint64_t anchor_tsc = slot.anchor_tsc.load(std::memory_order_relaxed);
+      int64_t base_micros = slot.base_micros.load(std::memory_order_relaxed);
+      uint64_t scale = slot.scale.load(std::memory_order_relaxed);
+      uint64_t tsc = __rdtsc();
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) != seq) continue;
+      if (scale != 0) {
+        int64_t delta = (int64_t)(tsc - anchor_tsc);
+        bool recalibrate = false;
+        if (delta < 0) {
+          // Skew between cores, or the TSC got reset (e.g. on resume).
+          delta = 0;
+          recalibrate = true;
+        }
+        int64_t elapsed =
+            (int64_t)(((unsigned __int128)delta * scale) >> kShift);
+        if (recalibrate || elapsed >= kRecalibrationIntervalMicros) {
+          maybeRecalibrate();
+        }
+        return base_micros + elapsed;
+      }
+      // Not calibrated (yet).
+      if (disabled_.load(std::memory_order_relaxed)) return monotonic_micros();
+      maybeRecalibrate();
+      int64_t micros = monotonic_micros();
+      std::atomic_thread_fence(std::memory_order_acquire);
+      // If the calibration has completed in the meantime, other callers may
+      // have already seen later, TSC-based values; use the TSC as well.
+      if (seq_.load(std::memory_order_relaxed) == seq) return micros;
+    }
+  }
+
+ private:
+  // Fixed-point precision of `scale`, which is in microseconds per tick. At
+  // 3 GHz, 2^40 gives a resolution of ~3 ppb.
+  static constexpr int kShift = 40;
+
+  static constexpr int64_t kInitialCalibrationMicros = 10000;
+  static constexpr int64_t kRecalibrationIntervalMicros = 1000000;
+  static constexpr int64_t kSwitchoverMarginMicros = 2;
+
+  struct Slot {
+    std::atomic<uint64_t> anchor_tsc{0};
+    std::atomic<int64_t> base_micros{0};
+    // Zero until calibrated.
+    std::atomic<uint64_t> scale{0};
+  };
+
+  // Reads CLOCK_MONOTONIC, and the TSC at about the same instant. Takes the
+  // best of a few attempts, in case of preemption.
+  static int64_t sample(uint64_t* tsc) {
+    int64_t micros = 0;
+    uint64_t best_gap = UINT64_MAX;
+    for (int i = 0; i < 3; ++i) {
+      uint64_t before = __rdtsc();
+      int64_t m = monotonic_micros();
+      uint64_t after = __rdtsc();
+      if (after - before < best_gap) {
+        best_gap = after - before;
+        *tsc = before + best_gap / 2;
+        micros = m;
+      }
+    }
+    return micros;
+  }
+
+  void maybeRecalibrate() {
+    if (updating_.exchange(true, std::memory_order_acquire)) {
+      // Someone else is on it.
+      return;
+    }
+    recalibrate();
+    updating_.store(false, std::memory_order_release);
+  }
+
+  // Called by at most one thread at a time.
+  void recalibrate() {
+    if (!calibration_started_) {
+      if (!has_invariant_tsc()) {
+        disabled_.store(true, std::memory_order_relaxed);
+        return;
+      }
+      calibration_micros_ = sample(&calibration_tsc_);
+      calibration_started_ = true;
+      return;
+    }
+    uint64_t tsc = 0;
+    int64_t micros = sample(&tsc);
+    if ((int64_t)(tsc - calibration_tsc_) <= 0) {
+      // The TSC went backwards; start over.
+      calibration_micros_ = micros;
+      calibration_tsc_ = tsc;
+      return;
+    }
+    int64_t span = micros - calibration_micros_;
+    if (span < kInitialCalibrationMicros) return;
+    uint64_t scale = (uint64_t)(((unsigned __int128)span << kShift) /
+                                (tsc - calibration_tsc_));
+    if (scale == 0) return;
+
+    const Slot& current = slots_[seq_.load(std::memory_order_relaxed) & 1];
+    int64_t base = micros;
+    uint64_t current_scale = current.scale.load(std::memory_order_relaxed);
+    if (current_scale == 0) {
+      // Switching over from CLOCK_MONOTONIC, which may have been read (and
+      // truncated) slightly after `micros`. Start a little ahead, so as not
+      // to go back.
+      base += kSwitchoverMarginMicros;
+    } else {
+      int64_t delta = (int64_t)(
+          tsc - current.anchor_tsc.load(std::memory_order_relaxed));
+      if (delta < 0) delta = 0;
+      int64_t predicted =
+          current.base_micros.load(std::memory_order_relaxed) +
+          (int64_t)(((unsigned __int128)delta * current_scale) >> kShift);
+      if (predicted > base) {
+        // Ahead of CLOCK_MONOTONIC. Slow down to catch up during the next
+        // interval, by at most 1/16.
+        int64_t ahead = predicted - base;
+        if (ahead > kRecalibrationIntervalMicros / 16) {
+          ahead = kRecalibrationIntervalMicros / 16;
+        }
+        scale -= (uint64_t)(((unsigned __int128)scale * ahead) /
+                            kRecalibrationIntervalMicros);
+        base = predicted;
+      }
+    }
+    publish(tsc, base, scale);
+  }
+
+  // Called by at most one thread at a time. While slot 0 is updated, readers
+  // use slot 1, and vice versa.
+  void publish(uint64_t anchor_tsc, int64_t base_micros, uint64_t scale) {
+    uint32_t seq = seq_.load(std::memory_order_relaxed);
+    for (int i = 0; i < 2; ++i) {
+      seq_.store(++seq, std::memory_order_release);
+      std::atomic_thread_fence(std::memory_order_release);
+      Slot& slot = slots_[(seq & 1) ^ 1];
+      slot.anchor_tsc.store(anchor_tsc, std::memory_order_relaxed);
+      slot.base_micros.store(base_micros, std::memory_order_relaxed);
+      slot.scale.store(scale, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<uint32_t> seq_;
+  Slot slots_[2];
+
+  std::atomic<bool> updating_;
+  std::atomic<bool> disabled_;
+
+  // Owned by the thread holding `updating_`.
+  bool calibration_started_;
+  uint64_t calibration_tsc_;
+  int64_t calibration_micros_;
+};
+
+}  // namespace internal
+}  // namespace roo_time
+
+#endif  // defined(__linux__) && defined(__x86_64__)
@@ -0,0 +1,103 @@
+#pragma once
+
+/// Internal, lock-free building blocks of `Uptime::Now()` on platforms whose
+/// native clock is not a monotone 64-bit microsecond counter.
+///
+/// Not part of the public API. Both classes are safe to call concurrently
+/// from multiple cores and from interrupt handlers: they never block, and
+/// cost a couple of atomic loads (plus, rarely, one compare-and-swap) on top
+/// of reading the underlying clock.
+
+#include <atomic>
+#include <inttypes.h>
+#include <stdint.h>
+
+namespace roo_time {
+namespace internal {
+
+// Extends a free-running, wrapping 32-bit counter (e.g. Arduino `micros()`,
+// which wraps every ~71.6 minutes) to a 64-bit one.
+//
+// The state is a single 32-bit word, holding the number of wrap-arounds seen
+// so far (in the upper 31 bits), and the top bit of the last observed counter
+// value (in the lowest bit). The state is loaded before the counter is read,
+// so the reading is never older than what the state describes, and a
+// wrap-around shows as the top bit going from 1 to 0. The state only needs
+// updating when the top bit flips, i.e. twice per period.
+//
+// Requires that the counter is extended at least once per half-period (i.e.
+// every ~35.8 minutes for a microsecond counter); otherwise, wrap-arounds go
+// unnoticed. Handles up to 2^31 wrap-arounds (~300000 years, for
+// microseconds).
+class CounterExtender32 {
+ public:
+  constexpr CounterExtender32() : state_(0) {}
+
+  // Returns the extended value of `read_counter()`, which must return the
+  // current (uint32_t) counter value.
+  template <typename ReadCounter>
+  uint64_t extend(ReadCounter&& read_counter) {
+    uint32_t state = state_.load(std::memory_order_acquire);
+    uint32_t reading = read_counter();
+    uint32_t wraps = state >> 1;
+    uint32_t top = reading >> 31;
+    // Top bit went 1 -> 0: the counter has wrapped around since the
+    // observation recorded in the state.
+    wraps += (state & ~top & 1);
+    uint32_t new_state = (wraps << 1) | top;
+    if (new_state != state) {
+      // Failure means that another caller has already recorded the same or a
+      // later observation. Either way, our result is correct.
+      state_.compare_exchange_strong(state, new_state,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_relaxed);
+    }
+    return ((uint64_t)wraps << 32) | reading;
+  }
+
+ private:
+  std::atomic<uint32_t> state_;
+};
+
+// Makes readings of a 64-bit clock that may occasionally step backwards (e.g.
+// Linux wall clock adjusted by NTP) monotone, by accumulating backward steps
+// into an offset, so that the adjusted clock continues from the highest value
+// returned so far, rather than stalling until the clock catches up.
+//
+// The returned values never decrease, also across threads.
+class MonotoneAdjuster {
+ public:
+  constexpr MonotoneAdjuster() : last_(INT64_MIN), offset_(0) {}
+
+  // Returns the adjusted value of `read_clock()`.
+  template <typename ReadClock>
+  int64_t adjust(ReadClock&& read_clock) {
+    int64_t last = last_.load(std::memory_order_acquire);
+    int64_t offset = offset_.load(std::memory_order_acquire);
+    int64_t now = read_clock() + offset;
+    if (now < last) {
+      // Either the clock stepped backwards, or another caller has published
+      // a reading that was adjusted with a newer offset. In the first case,
+      // absorb the step into the offset. In the second case, the CAS fails,
+      // because the offset has changed since we loaded it.
+      offset_.compare_exchange_strong(offset, offset + (last - now),
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_relaxed);
+      now = last;
+    }
+    // Publish the reading, unless another caller has published a later one,
+    // in which case return that one.
+    while (last < now &&
+           !last_.compare_exchange_weak(last, now, std::memory_order_acq_rel,
+                                        std::memory_order_acquire)) {
+    }
+    return last < now ? now : last;
+  }
+
+ private:
+  std::atomic<int64_t> last_;
+  std::atomic<int64_t> offset_;
+};
+
+}  // namespace internal
+}  // namespace roo_time
@@ -0,0 +1,34 @@
+#include "roo_time/lazy_date_time.h"
+
+#include "roo_time/internal/calendar.h"
+
+namespace roo_time {
+
+namespace {
+
+constexpr int64_t kMicrosPerDay = 24LL * 3600 * 1000000;
+
+}  // namespace
+
+void LazyDateTime::computeTimeOfDay() const {
+  int64_t local = (walltime_.sinceEpoch() + tz_.offset()).inMicros();
+  uint64_t since_midnight = internal::floor_mod(local, kMicrosPerDay);
+  micros_ = since_midnight % 1000000;
+  seconds_of_day_ = since_midnight / 1000000;
+  computed_ |= kTimeOfDay;
+}
+
+void LazyDateTime::computeDays() const {
+  int64_t local = (walltime_.sinceEpoch() + tz_.offset()).inMicros();
+  days_ = internal::floor_div(local, kMicrosPerDay);
+  computed_ |= kDays;
+}
+
+void LazyDateTime::computeDate() const {
+  ensureDays();
+  internal::civil_from_days(days_, &year_, &month_, &day_);
+  day_of_year_ = internal::day_of_year(year_, month_, day_);
+  computed_ |= kDate;
+}
+
+}  // namespace roo_time
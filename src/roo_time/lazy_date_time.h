@@ -0,0 +1,138 @@
+#pragma once
+
+/// Date/time decomposition that computes calendar fields on demand.
+
+#include "roo_time.h"
+#include "roo_time/internal/calendar.h"
+
+namespace roo_time {
+
+/// Represents wall time decomposed into date/time in a specific time zone,
+/// like `DateTime`, but derives the fields lazily.
+///
+/// Construction only records the wall time and time zone. Fields are computed
+/// on first access, in three independent groups, and memoized:
+///
+/// * time of day: `hour()`, `minute()`, `second()`, `micros()`;
+/// * day number: `dayOfWeek()`;
+/// * civil date: `year()`, `month()`, `day()`, `dayOfYear()`.
+///
+/// Hence, e.g. reading just `hour()` costs one 64-bit division, rather than a
+/// full calendar conversion. Prefer `DateTime` when most fields are needed.
+///
+/// Accessors update the memoized state, so a single instance must not be
+/// read concurrently from multiple threads.
+class LazyDateTime {
+ public:
+  /// Constructs `LazyDateTime` for `wall_time` in time zone `tz`.
+  LazyDateTime(WallTime wall_time, TimeZone tz)
+      : walltime_(wall_time),
+        tz_(tz),
+        computed_(0),
+        days_(0),
+        seconds_of_day_(0),
+        micros_(0),
+        year_(0),
+        month_(0),
+        day_(0),
+        day_of_year_(0) {}
+
+  /// Returns `WallTime` corresponding to this value.
+  [[nodiscard]] WallTime wallTime() const { return walltime_; }
+
+  /// Returns time zone of this value.
+  [[nodiscard]] TimeZone timeZone() const { return tz_; }
+
+  /// Returns four-digit year.
+  [[nodiscard]] int16_t year() const {
+    ensureDate();
+    return year_;
+  }
+
+  /// Returns month in [1, 12].
+  [[nodiscard]] Month month() const {
+    ensureDate();
+    return (Month)month_;
+  }
+
+  /// Returns day of month in valid range.
+  [[nodiscard]] uint8_t day() const {
+    ensureDate();
+    return day_;
+  }
+
+  /// Returns hour in [0, 23].
+  [[nodiscard]] uint8_t hour() const {
+    ensureTimeOfDay();
+    return seconds_of_day_ / 3600;
+  }
+
+  /// Returns minute in [0, 59].
+  [[nodiscard]] uint8_t minute() const {
+    ensureTimeOfDay();
+    return (seconds_of_day_ / 60) % 60;
+  }
+
+  /// Returns second in [0, 59].
+  [[nodiscard]] uint8_t second() const {
+    ensureTimeOfDay();
+    return seconds_of_day_ % 60;
+  }
+
+  /// Returns microsecond fraction in [0, 999999].
+  [[nodiscard]] uint32_t micros() const {
+    ensureTimeOfDay();
+    return micros_;
+  }
+
+  /// Returns day of week in this time zone.
+  [[nodiscard]] DayOfWeek dayOfWeek() const {
+    ensureDays();
+    return static_cast<DayOfWeek>(internal::weekday_from_days(days_));
+  }
+
+  /// Returns day of year in [1, 366].
+  [[nodiscard]] uint16_t dayOfYear() const {
+    ensureDate();
+    return day_of_year_;
+  }
+
+  /// Returns the equivalent, fully computed `DateTime`.
+  [[nodiscard]] DateTime toDateTime() const { return DateTime(walltime_, tz_); }
+
+ private:
+  // Bits of computed_.
+  static constexpr uint8_t kTimeOfDay = 1;
+  static constexpr uint8_t kDays = 2;
+  static constexpr uint8_t kDate = 4;
+
+  void ensureTimeOfDay() const {
+    if ((computed_ & kTimeOfDay) == 0) computeTimeOfDay();
+  }
+
+  void ensureDays() const {
+    if ((computed_ & kDays) == 0) computeDays();
+  }
+
+  void ensureDate() const {
+    if ((computed_ & kDate) == 0) computeDate();
+  }
+
+  void computeTimeOfDay() const;
+  void computeDays() const;
+  void computeDate() const;
+
+  WallTime walltime_;
+  TimeZone tz_;
+
+  mutable uint8_t computed_;
+  mutable int32_t days_;
+  mutable uint32_t seconds_of_day_;
+  mutable uint32_t micros_;
+  mutable int16_t year_;
+  mutable uint8_t month_;
+  mutable uint8_t day_;
+  mutable uint16_t day_of_year_;
+};
+
+}  // namespace roo_time
@@ -0,0 +1,174 @@
+#pragma once
+
+/// Compact, 8-byte representation of calendar date/time.
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Local calendar date/time packed into a single 64-bit word.
+///
+/// Intended for storing large arrays of calendar stamps in RAM or flash,
+/// where `DateTime` (about 32 bytes) would be too expensive. Stores the local
+/// civil fields (year, month, day, hour, minute, second, micros), but not the
+/// time zone; the zone needs to be supplied when converting back to
+/// `DateTime` or `WallTime`. Derived fields (day of week, day of year) are
+/// recomputed on conversion.
+///
+/// Bit layout, from the most significant bit:
+///
+///   [63:62] reserved (zero)
+///   [61:46] year, biased by 32768
+///   [45:42] month
+///   [41:37] day
+///   [36:32] hour
+///   [31:26] minute
+///   [25:20] second
+///   [19:0]  micros
+///
+/// Hence, comparing the packed words directly orders values by local civil
+/// time, which, for values in the same fixed-offset time zone, is the same as
+/// chronological order.
+class PackedDateTime {
+ public:
+  /// Constructs the value representing 1970-01-01 00:00:00.
+  constexpr PackedDateTime() : PackedDateTime(1970, 1, 1, 0, 0, 0, 0) {}
+
+  /// Constructs the value from civil fields. Performs no validation.
+  ///
+  /// @param year Year, in [-32768, 32767].
+  /// @param month Month in [1, 12].
+  /// @param day Day in [1, max_day_of_month].
+  /// @param hour Hour in [0, 23].
+  /// @param minute Minute in [0, 59].
+  /// @param second Second in [0, 59].
+  /// @param micros Microsecond fraction in [0, 999999].
+  constexpr PackedDateTime(int16_t year, uint8_t month, uint8_t day,
+                           uint8_t hour, uint8_t minute, uint8_t second,
+                           uint32_t micros)
+      : word_((uint64_t)(uint16_t)(year + 32768) << kYearShift |
+              (uint64_t)month << kMonthShift | (uint64_t)day << kDayShift |
+              (uint64_t)hour << kHourShift | (uint64_t)minute << kMinuteShift |
+              (uint64_t)second << kSecondShift | micros) {}
+
+  /// Packs the local civil fields of `dt`. The time zone is not retained.
+  explicit PackedDateTime(const DateTime& dt)
+      : PackedDateTime(dt.year(), dt.month(), dt.day(), dt.hour(), dt.minute(),
+                       dt.second(), dt.micros()) {}
+
+  /// Packs the local civil fields of `wall_time` in time zone `tz`.
+  static PackedDateTime FromWallTime(WallTime wall_time,
+                                     TimeZone tz = timezone::UTC) {
+    return PackedDateTime(DateTime(wall_time, tz));
+  }
+
+  /// Reconstructs the value from its packed representation, as returned by
+  /// `word()`.
+  static constexpr PackedDateTime FromWord(uint64_t word) {
+    return PackedDateTime(word);
+  }
+
+  /// Returns the packed representation.
+  [[nodiscard]] constexpr uint64_t word() const { return word_; }
+
+  /// Returns the year.
+  [[nodiscard]] constexpr int16_t year() const {
+    return (int32_t)((word_ >> kYearShift) & 0xFFFF) - 32768;
+  }
+
+  /// Returns month in [1, 12].
+  [[nodiscard]] constexpr Month month() const {
+    return (Month)((word_ >> kMonthShift) & 0xF);
+  }
+
+  /// Returns day of month.
+  [[nodiscard]] constexpr uint8_t day() const {
+    return (word_ >> kDayShift) & 0x1F;
+  }
+
+  /// Returns hour in [0, 23].
+  [[nodiscard]] constexpr uint8_t hour() const {
+    return (word_ >> kHourShift) & 0x1F;
+  }
+
+  /// Returns minute in [0, 59].
+  [[nodiscard]] constexpr uint8_t minute() const {
+    return (word_ >> kMinuteShift) & 0x3F;
+  }
+
+  /// Returns second in [0, 59].
+  [[nodiscard]] constexpr uint8_t second() const {
+    return (word_ >> kSecondShift) & 0x3F;
+  }
+
+  /// Returns microsecond fraction in [0, 999999].
+  [[nodiscard]] constexpr uint32_t micros() const { return word_ & 0xFFFFF; }
+
+  /// Returns `DateTime` with these civil fields in time zone `tz`.
+  [[nodiscard]] constexpr DateTime toDateTime(
+      TimeZone tz = timezone::UTC) const {
+    return DateTime(year(), month(), day(), hour(), minute(), second(),
+                    micros(), tz);
+  }
+
+  /// Returns the instant at which the local civil time in time zone `tz`
+  /// equals this value. Cheaper than `toDateTime(tz).wallTime()`.
+  [[nodiscard]] constexpr WallTime toWallTime(
+      TimeZone tz = timezone::UTC) const {
+    return WallTimeFromCivil(year(), month(), day(), hour(), minute(),
+                             second(), micros(), tz);
+  }
+
+ private:
+  static constexpr int kSecondShift = 20;
+  static constexpr int kMinuteShift = 26;
+  static constexpr int kHourShift = 32;
+  static constexpr int kDayShift = 37;
+  static constexpr int kMonthShift = 42;
+  static constexpr int kYearShift = 46;
+
+  constexpr explicit PackedDateTime(uint64_t word) : word_(word) {}
+
+  uint64_t word_;
+};
+
+static_assert(sizeof(PackedDateTime) == 8,
+              "PackedDateTime must occupy exactly 8 bytes");
+
+/// Returns true if both values have the same civil fields.
+inline constexpr bool operator==(const PackedDateTime& a,
+                                 const PackedDateTime& b) {
+  return a.word() == b.word();
+}
+
+/// Returns true if the values differ in any civil field.
+inline constexpr bool operator!=(const PackedDateTime& a,
+                                 const PackedDateTime& b) {
+  return a.word() != b.word();
+}
+
+/// Returns true if `a` is earlier in civil time than `b`.
+inline constexpr bool operator<(const PackedDateTime& a,
+                                const PackedDateTime& b) {
+  return a.word() < b.word();
+}
+
+/// Returns true if `a` is later in civil time than `b`.
+inline constexpr bool operator>(const PackedDateTime& a,
+                                const PackedDateTime& b) {
+  return a.word() > b.word();
+}
+
+/// Returns true if `a` is not later in civil time than `b`.
+inline constexpr bool operator<=(const PackedDateTime& a,
+                                 const PackedDateTime& b) {
+  return a.word() <= b.word();
+}
+
+/// Returns true if `a` is not earlier in civil time than `b`.
+inline constexpr bool operator>=(const PackedDateTime& a,
+                                 const PackedDateTime& b) {
+  return a.word() >= b.word();
+}
+
+}  // namespace roo_time
@@ -0,0 +1,184 @@
+#include "roo_time/parse.h"
+
+#include <string.h>
+
+#include "roo_time/internal/calendar.h"
+
+// Selects how the fixed-width "YYYY-MM-DDTHH:MM:SS" prefix is parsed. When 1,
+// uses 64-bit SWAR arithmetic, which requires a little-endian target. When 0,
+// parses character by character. Defaults to 1 on little-endian targets.
+#ifndef ROO_TIME_PARSE_SWAR
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ROO_TIME_PARSE_SWAR 1
+#else
+#define ROO_TIME_PARSE_SWAR 0
+#endif
+#endif
+
+namespace roo_time {
+
+namespace {
+
+// Length of "YYYY-MM-DDTHH:MM:SS".
+constexpr size_t kPrefixLength = 19;
+
+struct Fields {
+  uint16_t year;
+  uint8_t month;
+  uint8_t day;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t second;
+};
+
+bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+bool IsDateTimeSeparator(char c) { return c == 'T' || c == 't' || c == ' '; }
+
+// Parses two digits at `p`.
+bool ParseTwoDigits(const char* p, uint8_t* result) {
+  if (!IsDigit(p[0]) || !IsDigit(p[1])) return false;
+  *result = (p[0] - '0') * 10 + (p[1] - '0');
+  return true;
+}
+
+#if ROO_TIME_PARSE_SWAR
+
+uint64_t Load64(const char* p) {
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+// Returns true if all bytes of `v` are ASCII digits. Carries between bytes
+// only originate from bytes >= 0xFA, which fail the check themselves.
+bool AllDigits(uint64_t v) {
+  return ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Validates the 8 characters in `v` (first character in the lowest byte):
+// bytes selected by `sep_mask` must equal the corresponding bytes of `seps`,
+// and all others must be digits. On success, stores the two-digit values
+// starting at each byte position k (i.e. 10 * digit[k] + digit[k + 1]) in the
+// corresponding byte of `pairs`.
+bool ParseChunk(uint64_t v, uint64_t sep_mask, uint64_t seps,
+                uint64_t* pairs) {
+  if ((v & sep_mask) != seps) return false;
+  uint64_t digits = (v & ~sep_mask) | (0x3030303030303030ULL & sep_mask);
+  if (!AllDigits(digits)) return false;
+  uint64_t x = digits - 0x3030303030303030ULL;
+  // Each byte of x is in [0, 9], so neither term carries between bytes.
+  *pairs = x * 10 + (x >> 8);
+  return true;
+}
+
+uint8_t Byte(uint64_t v, int k) { return (v >> (8 * k)) & 0xFF; }
+
+bool ParsePrefix(const char* p, Fields* f) {
+  // "YYYY-MM-": separators at bytes 4 and 7.
+  uint64_t date;
+  if (!ParseChunk(Load64(p), 0xFF0000FF00000000ULL, 0x2D00002D00000000ULL,
+                  &date)) {
+    return false;
+  }
+  // "HH:MM:SS" (at offset 11): separators at bytes 2 and 5.
+  uint64_t time;
+  if (!ParseChunk(Load64(p + 11), 0x0000FF0000FF0000ULL,
+                  0x00003A00003A0000ULL, &time)) {
+    return false;
+  }
+  if (!ParseTwoDigits(p + 8, &f->day) || !IsDateTimeSeparator(p[10])) {
+    return false;
+  }
+  f->year = Byte(date, 0) * 100 + Byte(date, 2);
+  f->month = Byte(date, 5);
+  f->hour = Byte(time, 0);
+  f->minute = Byte(time, 3);
+  f->second = Byte(time, 6);
+  return true;
+}
+
+#else
+
+bool ParsePrefix(const char* p, Fields* f) {
+  uint8_t century;
+  uint8_t year;
+  if (!ParseTwoDigits(p, &century) || !ParseTwoDigits(p + 2, &year) ||
+      p[4] != '-' || !ParseTwoDigits(p + 5, &f->month) || p[7] != '-' ||
+      !ParseTwoDigits(p + 8, &f->day) || !IsDateTimeSeparator(p[10]) ||
+      !ParseTwoDigits(p + 11, &f->hour) || p[13] != ':' ||
+      !ParseTwoDigits(p + 14, &f->minute) || p[16] != ':' ||
+      !ParseTwoDigits(p + 17, &f->second)) {
+    return false;
+  }
+  f->year = century * 100 + year;
+  return true;
+}
+
+#endif  // ROO_TIME_PARSE_SWAR
+
+}  // namespace
+
+bool ParseRfc3339(const char* str, size_t len, WallTime* result,
+                  TimeZone* tz) {
+  // The shortest valid timestamp is "YYYY-MM-DDTHH:MM:SSZ".
+  if (len < kPrefixLength + 1) return false;
+  Fields f;
+  if (!ParsePrefix(str, &f)) return false;
+  if (f.month < 1 || f.month > 12 || f.day < 1 ||
+      f.day > internal::last_day_of_month(f.year, f.month) || f.hour > 23 ||
+      f.minute > 59 || f.second > 59) {
+    return false;
+  }
+  const char* p = str + kPrefixLength;
+  const char* end = str + len;
+  uint32_t micros = 0;
+  if (*p == '.') {
+    ++p;
+    if (p == end || !IsDigit(*p)) return false;
+    uint32_t scale = 100000;
+    while (p < end && IsDigit(*p)) {
+      micros += (*p++ - '0') * scale;
+      scale /= 10;
+    }
+  }
+  if (p == end) return false;
+  int16_t offset_minutes = 0;
+  if (*p == 'Z' || *p == 'z') {
+    ++p;
+  } else if (*p == '+' || *p == '-') {
+    uint8_t hours;
+    uint8_t minutes;
+    if (end - p < 6 || !ParseTwoDigits(p + 1, &hours) || p[3] != ':' ||
+        !ParseTwoDigits(p + 4, &minutes) || hours > 23 || minutes > 59) {
+      return false;
+    }
+    offset_minutes = hours * 60 + minutes;
+    if (*p == '-') offset_minutes = -offset_minutes;
+    p += 6;
+  } else {
+    return false;
+  }
+  if (p != end) return false;
+  TimeZone parsed_tz(Minutes(offset_minutes));
+  *result = WallTimeFromCivil(f.year, f.month, f.day, f.hour, f.minute,
+                              f.second, micros, parsed_tz);
+  if (tz != nullptr) *tz = parsed_tz;
+  return true;
+}
+
+bool ParseRfc3339(const char* str, WallTime* result, TimeZone* tz) {
+  return ParseRfc3339(str, strlen(str), result, tz);
+}
+
+bool ParseRfc3339(const char* str, size_t len, DateTime* result) {
+  WallTime t;
+  TimeZone tz;
+  if (!ParseRfc3339(str, len, &t, &tz)) return false;
+  *result = DateTime(t, tz);
+  return true;
+}
+
+}  // namespace roo_time
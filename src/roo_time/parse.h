@@ -0,0 +1,36 @@
+#pragma once
+
+/// RFC 3339 (ISO 8601) timestamp parsing.
+
+#include <stddef.h>
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Parses an RFC 3339 timestamp, e.g. "2024-07-01T14:00:00.250+02:00", from
+/// the `len` characters at `str` (which need not be NUL-terminated).
+///
+/// Accepts 'T', 't', or ' ' as the date/time separator, 'Z' or 'z' for UTC,
+/// and any number of fractional digits (truncated to microseconds). Validates
+/// all fields, including the day of month. Leap seconds (":60") are rejected,
+/// as `WallTime` does not represent them. The whole input must be consumed.
+///
+/// On success, stores the instant in `result`, and, if `tz` is not null, the
+/// parsed UTC offset in `tz`, and returns true. On failure, returns false,
+/// leaving the outputs unchanged.
+///
+/// On little-endian targets, the fixed-width "YYYY-MM-DDTHH:MM:SS" prefix is
+/// validated and converted with 64-bit SWAR arithmetic, a few characters at a
+/// time, rather than character by character.
+bool ParseRfc3339(const char* str, size_t len, WallTime* result,
+                  TimeZone* tz = nullptr);
+
+/// As above, for a NUL-terminated string.
+bool ParseRfc3339(const char* str, WallTime* result, TimeZone* tz = nullptr);
+
+/// Parses an RFC 3339 timestamp, as above, into `DateTime` in the parsed time
+/// zone.
+bool ParseRfc3339(const char* str, size_t len, DateTime* result);
+
+}  // namespace roo_time
@@ -0,0 +1,268 @@
+#include "roo_time/posix_tz.h"
+
+#include "roo_time/internal/calendar.h"
+
+namespace roo_time {
+
+namespace {
+
+constexpr int32_t kSecondsPerDay = 24 * 3600;
+
+// Default transition time of date rules: 02:00:00 local.
+constexpr int32_t kDefaultRuleTime = 2 * 3600;
+
+bool IsAlpha(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Parses a decimal number in [min, max]. Returns nullptr on failure.
+const char* ParseNumber(const char* p, int32_t min, int32_t max,
+                        int32_t* result) {
+  if (!IsDigit(*p)) return nullptr;
+  int32_t value = 0;
+  while (IsDigit(*p)) {
+    value = value * 10 + (*p++ - '0');
+    if (value > max) return nullptr;
+  }
+  if (value < min) return nullptr;
+  *result = value;
+  return p;
+}
+
+// Parses [+-]hh[:mm[:ss]], with hh in [0, max_hours]. Returns the signed
+// number of seconds. Returns nullptr on failure.
+const char* ParseTime(const char* p, int32_t max_hours, int32_t* result) {
+  int32_t sign = 1;
+  if (*p == '+') {
+    ++p;
+  } else if (*p == '-') {
+    sign = -1;
+    ++p;
+  }
+  int32_t hours;
+  int32_t minutes = 0;
+  int32_t seconds = 0;
+  p = ParseNumber(p, 0, max_hours, &hours);
+  if (p == nullptr) return nullptr;
+  if (*p == ':') {
+    p = ParseNumber(p + 1, 0, 59, &minutes);
+    if (p == nullptr) return nullptr;
+    if (*p == ':') {
+      p = ParseNumber(p + 1, 0, 59, &seconds);
+      if (p == nullptr) return nullptr;
+    }
+  }
+  *result = sign * (hours * 3600 + minutes * 60 + seconds);
+  return p;
+}
+
+}  // namespace
+
+PosixTimeZone::PosixTimeZone()
+    : std_name_("UTC"),
+      dst_name_(""),
+      std_offset_(0),
+      dst_offset_(0),
+      has_dst_(false),
+      start_(),
+      end_(),
+      cache_begin_(0),
+      cache_end_(0),
+      cache_dst_start_(0),
+      cache_dst_end_(0) {}
+
+bool PosixTimeZone::parse(const char* spec) {
+  PosixTimeZone result;
+  const char* p = ParseName(spec, result.std_name_);
+  if (p == nullptr) return false;
+  // POSIX offsets are positive west of Greenwich.
+  int32_t offset;
+  p = ParseTime(p, 24, &offset);
+  if (p == nullptr) return false;
+  result.std_offset_ = -offset;
+  result.dst_offset_ = -offset;
+  if (*p != '\0') {
+    p = ParseName(p, result.dst_name_);
+    if (p == nullptr) return false;
+    result.has_dst_ = true;
+    result.dst_offset_ = result.std_offset_ + 3600;
+    if (*p != ',' && *p != '\0') {
+      p = ParseTime(p, 24, &offset);
+      if (p == nullptr) return false;
+      result.dst_offset_ = -offset;
+    }
+    if (*p == '\0') {
+      // The rules are implementation-defined when omitted; follow glibc,
+      // which uses the current US rules.
+      p = ",M3.2.0,M11.1.0";
+    }
+    if (*p != ',') return false;
+    p = ParseRule(p + 1, &result.start_);
+    if (p == nullptr || *p != ',') return false;
+    p = ParseRule(p + 1, &result.end_);
+    if (p == nullptr) return false;
+  }
+  if (*p != '\0') return false;
+  *this = result;
+  return true;
+}
+
+bool PosixTimeZone::transitions(int16_t year, WallTime* dst_start,
+                                WallTime* dst_end) const {
+  if (!has_dst_) return false;
+  *dst_start = WallTime(Seconds(TransitionTime(start_, year, std_offset_)));
+  *dst_end = WallTime(Seconds(TransitionTime(end_, year, dst_offset_)));
+  return true;
+}
+
+bool PosixTimeZone::isDaylightTime(WallTime t) const {
+  if (!has_dst_) return false;
+  return isDaylightTimeAt(
+      internal::floor_div<int64_t>(t.sinceEpoch().inMicros(), 1000000));
+}
+
+bool PosixTimeZone::transitionBetween(WallTime lo, WallTime hi,
+                                      WallTime* transition) const {
+  if (!has_dst_ || dst_offset_ == std_offset_) return false;
+  // Transitions are at whole seconds, so the ones in (lo, hi] are those in
+  // (floor(lo), floor(hi)].
+  int64_t seconds =
+      internal::floor_div<int64_t>(lo.sinceEpoch().inMicros(), 1000000);
+  int64_t last =
+      internal::floor_div<int64_t>(hi.sinceEpoch().inMicros(), 1000000);
+  bool dst = isDaylightTimeAt(seconds);
+  while (seconds < last) {
+    // With the cache covering `seconds`, isDaylightTimeAt() can only change
+    // at the cached transitions, and at the end of the year.
+    int64_t next = cache_end_;
+    if (cache_dst_start_ > seconds && cache_dst_start_ < next) {
+      next = cache_dst_start_;
+    }
+    if (cache_dst_end_ > seconds && cache_dst_end_ < next) {
+      next = cache_dst_end_;
+    }
+    if (next > last) return false;
+    seconds = next;
+    if (isDaylightTimeAt(seconds) != dst) {
+      *transition = WallTime(Seconds(seconds));
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PosixTimeZone::isDaylightTimeAt(int64_t seconds) const {
+  if (seconds < cache_begin_ || seconds >= cache_end_) updateCache(seconds);
+  if (cache_dst_start_ < cache_dst_end_) {
+    // Northern hemisphere: DST in the middle of the year.
+    return seconds >= cache_dst_start_ && seconds < cache_dst_end_;
+  } else {
+    // Southern hemisphere: DST at the beginning and the end of the year.
+    return seconds >= cache_dst_start_ || seconds < cache_dst_end_;
+  }
+}
+
+const char* PosixTimeZone::ParseName(const char* p, char* name) {
+  int len = 0;
+  if (*p == '<') {
+    ++p;
+    while (IsAlpha(*p) || IsDigit(*p) || *p == '+' || *p == '-') {
+      if (len == kMaxNameLength) return nullptr;
+      name[len++] = *p++;
+    }
+    if (*p != '>') return nullptr;
+    ++p;
+  } else {
+    while (IsAlpha(*p)) {
+      if (len == kMaxNameLength) return nullptr;
+      name[len++] = *p++;
+    }
+  }
+  if (len < 3) return nullptr;
+  name[len] = '\0';
+  return p;
+}
+
+const char* PosixTimeZone::ParseRule(const char* p, Rule* rule) {
+  int32_t value;
+  if (*p == 'M') {
+    rule->kind = Rule::kMonthWeekDay;
+    p = ParseNumber(p + 1, 1, 12, &value);
+    if (p == nullptr || *p != '.') return nullptr;
+    rule->month = value;
+    p = ParseNumber(p + 1, 1, 5, &value);
+    if (p == nullptr || *p != '.') return nullptr;
+    rule->week = value;
+    p = ParseNumber(p + 1, 0, 6, &value);
+    if (p == nullptr) return nullptr;
+    rule->weekday = value;
+  } else if (*p == 'J') {
+    rule->kind = Rule::kJulianNoLeap;
+    p = ParseNumber(p + 1, 1, 365, &value);
+    if (p == nullptr) return nullptr;
+    rule->day = value;
+  } else {
+    rule->kind = Rule::kJulian;
+    p = ParseNumber(p, 0, 365, &value);
+    if (p == nullptr) return nullptr;
+    rule->day = value;
+  }
+  rule->time = kDefaultRuleTime;
+  if (*p == '/') {
+    // RFC 8536 extends the range of hours to [-167, 167].
+    p = ParseTime(p + 1, 167, &rule->time);
+  }
+  return p;
+}
+
+int64_t PosixTimeZone::TransitionTime(const Rule& rule, int16_t year,
+                                      int32_t offset_before) {
+  int32_t days = internal::days_from_civil(year, 1, 1);
+  switch (rule.kind) {
+    case Rule::kJulianNoLeap: {
+      days += rule.day - 1;
+      if (rule.day >= 60 && internal::is_leap(year)) ++days;
+      break;
+    }
+    case Rule::kJulian: {
+      days += rule.day;
+      break;
+    }
+    case Rule::kMonthWeekDay: {
+      days = internal::days_from_civil(year, rule.month, 1);
+      // First occurrence of the weekday in the month.
+      days += (rule.weekday + 7 - internal::weekday_from_days(days)) % 7;
+      days += (rule.week - 1) * 7;
+      if (rule.week == 5) {
+        int32_t last = internal::days_from_civil(
+            year, rule.month, internal::last_day_of_month(year, rule.month));
+        if (days > last) days -= 7;
+      }
+      break;
+    }
+  }
+  return (int64_t)days * kSecondsPerDay + rule.time - offset_before;
+}
+
+void PosixTimeZone::updateCache(int64_t seconds) const {
+  // The year is determined in local standard time, in which the rules are
+  // expressed.
+  int64_t days = internal::floor_div<int64_t>(seconds + std_offset_,
+                                              kSecondsPerDay);
+  int16_t year;
+  uint8_t month;
+  uint8_t day;
+  internal::civil_from_days(days, &year, &month, &day);
+  cache_begin_ = (int64_t)internal::days_from_civil(year, 1, 1) *
+                     kSecondsPerDay -
+                 std_offset_;
+  cache_end_ = (int64_t)internal::days_from_civil(year + 1, 1, 1) *
+                   kSecondsPerDay -
+               std_offset_;
+  cache_dst_start_ = TransitionTime(start_, year, std_offset_);
+  cache_dst_end_ = TransitionTime(end_, year, dst_offset_);
+}
+
+}  // namespace roo_time
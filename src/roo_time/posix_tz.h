@@ -0,0 +1,133 @@
+#pragma once
+
+/// Time zones defined by POSIX TZ strings, e.g. "CET-1CEST,M3.5.0,M10.5.0/3".
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Time zone defined by a POSIX TZ rule string (as in the `TZ` environment
+/// variable, or the footer of TZif files).
+///
+/// The string is parsed once, by `parse()`. Offsets are then evaluated lazily:
+/// the two daylight saving transitions are computed for the year of the
+/// requested instant, and cached, so that subsequent lookups within the same
+/// year take a couple of comparisons.
+///
+/// Supports the full POSIX syntax, including quoted (`<+0330>`) names, the
+/// `Jn`, `n`, and `Mm.w.d` date rules, and transition times outside
+/// [0, 24h) (as permitted by RFC 8536).
+///
+/// Because of the cache, a single instance must not be used concurrently from
+/// multiple threads. The object is small and cheap to copy; give each thread
+/// its own copy.
+class PosixTimeZone : public TimeZoneRules {
+ public:
+  /// Maximum length of a time zone abbreviation (e.g. "CEST").
+  static constexpr int kMaxNameLength = 7;
+
+  /// Constructs the UTC zone.
+  PosixTimeZone();
+
+  /// Parses the specified POSIX TZ string, and initializes this zone from it.
+  ///
+  /// Returns false if the string is malformed, in which case this zone
+  /// remains unchanged.
+  bool parse(const char* spec);
+
+  /// Returns the UTC offset of standard time.
+  [[nodiscard]] TimeZone standardTime() const {
+    return TimeZone(Seconds(std_offset_));
+  }
+
+  /// Returns the UTC offset of daylight saving time. If the zone does not
+  /// observe daylight saving time, returns the standard offset.
+  [[nodiscard]] TimeZone daylightTime() const {
+    return TimeZone(Seconds(dst_offset_));
+  }
+
+  /// Returns true if the zone observes daylight saving time.
+  [[nodiscard]] bool hasDaylightTime() const { return has_dst_; }
+
+  /// Returns the abbreviation of standard time (e.g. "CET").
+  [[nodiscard]] const char* standardName() const { return std_name_; }
+
+  /// Returns the abbreviation of daylight saving time (e.g. "CEST"), or an
+  /// empty string if the zone does not observe daylight saving time.
+  [[nodiscard]] const char* daylightName() const { return dst_name_; }
+
+  /// Computes the instants at which daylight saving time starts and ends in
+  /// the specified year. Returns false (leaving the outputs unchanged) if the
+  /// zone does not observe daylight saving time.
+  bool transitions(int16_t year, WallTime* dst_start, WallTime* dst_end) const;
+
+  /// Returns true if daylight saving time is in effect at instant `t`.
+  [[nodiscard]] bool isDaylightTime(WallTime t) const;
+
+  /// Returns the UTC offset in effect at instant `t`.
+  TimeZone timeZoneAt(WallTime t) const override {
+    return TimeZone(Seconds(isDaylightTime(t) ? dst_offset_ : std_offset_));
+  }
+
+  /// Finds the first offset change in (`lo`, `hi`]. Takes a couple of
+  /// comparisons against the cached transitions of the year, for intervals
+  /// within a year.
+  bool transitionBetween(WallTime lo, WallTime hi,
+                         WallTime* transition) const override;
+
+ private:
+  // Date rule of a transition.
+  struct Rule {
+    enum Kind : uint8_t {
+      // Jn: Julian day in [1, 365], never counting February 29.
+      kJulianNoLeap,
+
+      // n: zero-based Julian day in [0, 365], counting February 29.
+      kJulian,
+
+      // Mm.w.d: day d (0 = Sunday) of week w (5 = last) of month m.
+      kMonthWeekDay,
+    };
+
+    Kind kind;
+    uint8_t month;
+    uint8_t week;
+    uint8_t weekday;
+    uint16_t day;
+
+    // Local time of the transition, in seconds since midnight.
+    int32_t time;
+  };
+
+  static const char* ParseName(const char* p, char* name);
+  static const char* ParseRule(const char* p, Rule* rule);
+
+  // Returns the transition instant in seconds since Epoch, for the specified
+  // rule in the specified year, given the UTC offset in effect before the
+  // transition.
+  static int64_t TransitionTime(const Rule& rule, int16_t year,
+                                int32_t offset_before);
+
+  void updateCache(int64_t seconds) const;
+
+  // Like isDaylightTime(), for `seconds` since Epoch. Updates the cache to
+  // the year of `seconds`.
+  bool isDaylightTimeAt(int64_t seconds) const;
+
+  char std_name_[kMaxNameLength + 1];
+  char dst_name_[kMaxNameLength + 1];
+  int32_t std_offset_;  // Seconds east of UTC.
+  int32_t dst_offset_;  // Seconds east of UTC.
+  bool has_dst_;
+  Rule start_;
+  Rule end_;
+
+  // Cached transitions for the year [cache_begin_, cache_end_), in seconds
+  // since Epoch.
+  mutable int64_t cache_begin_;
+  mutable int64_t cache_end_;
+  mutable int64_t cache_dst_start_;
+  mutable int64_t cache_dst_end_;
+};
+
+}  // namespace roo_time
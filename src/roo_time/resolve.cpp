@@ -0,0 +1,71 @@
+#include "roo_time/resolve.h"
+
+namespace roo_time {
+
+LocalTimeResolution ResolveLocalTime(int16_t year, uint8_t month, uint8_t day,
+                                     uint8_t hour, uint8_t minute,
+                                     uint8_t second, uint32_t micros,
+                                     const TimeZoneRules& zone) {
+  // The local time, as if it were UTC. The instant we are looking for is
+  // within a day of it.
+  WallTime local = WallTimeFromCivil(year, month, day, hour, minute, second,
+                                     micros, timezone::UTC);
+  Duration offset_before = zone.timeZoneAt(local - Hours(24)).offset();
+  Duration offset_after = zone.timeZoneAt(local + Hours(24)).offset();
+  WallTime t_before = local - offset_before;
+  if (offset_before == offset_after) {
+    return LocalTimeResolution{LocalTimeResolution::kUnique, t_before,
+                               t_before};
+  }
+  // There is a transition nearby. Each candidate is valid if the offset it
+  // assumed is actually in effect at that instant.
+  WallTime t_after = local - offset_after;
+  bool before_valid = (zone.timeZoneAt(t_before).offset() == offset_before);
+  bool after_valid = (zone.timeZoneAt(t_after).offset() == offset_after);
+  if (before_valid && after_valid) {
+    // Clocks turned back: t_before < t_after.
+    return LocalTimeResolution{LocalTimeResolution::kAmbiguous, t_before,
+                               t_after};
+  }
+  if (before_valid) {
+    return LocalTimeResolution{LocalTimeResolution::kUnique, t_before,
+                               t_before};
+  }
+  if (after_valid) {
+    return LocalTimeResolution{LocalTimeResolution::kUnique, t_after, t_after};
+  }
+  // Clocks turned forward: the transition is in (t_after, t_before]. (If the
+  // zone is inconsistent and reports none, assume the latest possible.)
+  WallTime transition = t_before;
+  zone.transitionBetween(t_after, t_before, &transition);
+  return LocalTimeResolution{LocalTimeResolution::kSkipped, transition,
+                             t_before};
+}
+
+bool WallTimeFromLocal(int16_t year, uint8_t month, uint8_t day, uint8_t hour,
+                       uint8_t minute, uint8_t second, uint32_t micros,
+                       const TimeZoneRules& zone, LocalTimePolicy policy,
+                       WallTime* result) {
+  LocalTimeResolution r = ResolveLocalTime(year, month, day, hour, minute,
+                                           second, micros, zone);
+  if (r.kind == LocalTimeResolution::kUnique) {
+    *result = r.earliest;
+    return true;
+  }
+  switch (policy) {
+    case LocalTimePolicy::kEarliest: {
+      *result = r.earliest;
+      return true;
+    }
+    case LocalTimePolicy::kLatest: {
+      *result = r.latest;
+      return true;
+    }
+    case LocalTimePolicy::kReject:
+    default: {
+      return false;
+    }
+  }
+}
+
+}  // namespace roo_time
@@ -0,0 +1,71 @@
+#pragma once
+
+/// Conversion of local civil time to wall time, in zones with daylight saving
+/// time.
+
+#include "roo_time.h"
+
+namespace roo_time {
+
+/// Result of mapping local civil time to wall time in a `TimeZoneRules` zone.
+struct LocalTimeResolution {
+  enum Kind {
+    /// The local time occurs exactly once; `earliest` == `latest`.
+    kUnique,
+
+    /// The local time occurs twice, because the clocks were turned back (e.g.
+    /// at the end of daylight saving time). `earliest` and `latest` are the
+    /// two occurrences.
+    kAmbiguous,
+
+    /// The local time does not occur, because the clocks were turned forward
+    /// over it (e.g. at the start of daylight saving time). `earliest` is the
+    /// transition instant, i.e. the first instant after the gap; `latest` is
+    /// the requested time shifted forward by the length of the gap.
+    kSkipped,
+  };
+
+  Kind kind;
+  WallTime earliest;
+  WallTime latest;
+};
+
+/// Maps local civil time in `zone` to wall time, detecting times that are
+/// skipped or repeated due to UTC offset changes.
+///
+/// Takes two `timeZoneAt()` lookups for times more than a day away from any
+/// offset change, and four otherwise. Skipped times additionally take one
+/// `transitionBetween()` lookup, to find the end of the gap.
+///
+/// Assumes that the offset changes at most once within a day on either side
+/// of the requested time, and that offsets are less than 24 hours, which holds
+/// for all real-world zones.
+LocalTimeResolution ResolveLocalTime(int16_t year, uint8_t month, uint8_t day,
+                                     uint8_t hour, uint8_t minute,
+                                     uint8_t second, uint32_t micros,
+                                     const TimeZoneRules& zone);
+
+/// Specifies how `WallTimeFromLocal()` handles local times that are skipped or
+/// repeated.
+enum class LocalTimePolicy {
+  /// Picks `LocalTimeResolution::earliest`: the first occurrence of a repeated
+  /// time, or the end of the gap for a skipped time.
+  kEarliest,
+
+  /// Picks `LocalTimeResolution::latest`: the second occurrence of a repeated
+  /// time, or the skipped time shifted forward by the length of the gap.
+  kLatest,
+
+  /// Fails on repeated and skipped times.
+  kReject,
+};
+
+/// Maps local civil time in `zone` to wall time, resolving skipped and
+/// repeated times according to `policy`. Returns false (leaving `result`
+/// unchanged) if the time is rejected by the policy.
+bool WallTimeFromLocal(int16_t year, uint8_t month, uint8_t day, uint8_t hour,
+                       uint8_t minute, uint8_t second, uint32_t micros,
+                       const TimeZoneRules& zone, LocalTimePolicy policy,
+                       WallTime* result);
+
+}  // namespace roo_time
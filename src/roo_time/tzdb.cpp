@@ -0,0 +1,83 @@
+#include "roo_time/tzdb.h"
+
+#include <string.h>
+
+#include "roo_time/internal/calendar.h"
+
+namespace roo_time {
+
+bool TzdbTimeZone::posixZone(PosixTimeZone* zone) const {
+  return posix_rule_ != nullptr && zone->parse(posix_rule_);
+}
+
+bool TzdbTimeZone::covers(WallTime t) const {
+  if (t < tableEnd()) return true;
+  PosixTimeZone zone;
+  return posixZone(&zone);
+}
+
+uint16_t TzdbTimeZone::transitionsUpTo(int64_t seconds) const {
+  const int32_t* base = transitions_;
+  uint16_t n = transition_count_;
+  if (n == 0 || seconds < base[0]) return 0;
+  while (n > 1) {
+    uint16_t half = n / 2;
+    if (base[half] <= seconds) base += half;
+    n -= half;
+  }
+  return base - transitions_ + 1;
+}
+
+TimeZone TzdbTimeZone::timeZoneAt(WallTime t) const {
+  int64_t seconds =
+      internal::floor_div<int64_t>(t.sinceEpoch().inMicros(), 1000000);
+  if (seconds >= table_end_) {
+    PosixTimeZone zone;
+    if (posixZone(&zone)) return zone.timeZoneAt(t);
+  }
+  return TimeZone(Minutes(offsets_minutes_[transitionsUpTo(seconds)]));
+}
+
+bool TzdbTimeZone::transitionBetween(WallTime lo, WallTime hi,
+                                     WallTime* transition) const {
+  // Transitions are at whole seconds, so the ones in (lo, hi] are those in
+  // (floor(lo), floor(hi)].
+  int64_t lo_seconds =
+      internal::floor_div<int64_t>(lo.sinceEpoch().inMicros(), 1000000);
+  int64_t hi_seconds =
+      internal::floor_div<int64_t>(hi.sinceEpoch().inMicros(), 1000000);
+  if (hi_seconds <= lo_seconds) return false;
+  if (lo_seconds < table_end_) {
+    for (uint16_t i = transitionsUpTo(lo_seconds);
+         i < transition_count_ && transitions_[i] <= hi_seconds; ++i) {
+      if (offsets_minutes_[i + 1] != offsets_minutes_[i]) {
+        *transition = WallTime(Seconds(transitions_[i]));
+        return true;
+      }
+    }
+    if (hi_seconds < table_end_) return false;
+  }
+  PosixTimeZone zone;
+  if (!posixZone(&zone)) return false;
+  if (lo_seconds < table_end_) {
+    // The rule takes over at the end of the table.
+    if (zone.timeZoneAt(tableEnd()).offset() !=
+        Minutes(offsets_minutes_[transition_count_])) {
+      *transition = tableEnd();
+      return true;
+    }
+    lo = tableEnd();
+  }
+  return zone.transitionBetween(lo, hi, transition);
+}
+
+const TzdbTimeZone* FindTzdbZone(const char* name) {
+  for (uint16_t i = 0; i < internal::kTzdbZoneCount; ++i) {
+    if (strcmp(internal::kTzdbZones[i]->name(), name) == 0) {
+      return internal::kTzdbZones[i];
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace roo_time
@@ -0,0 +1,127 @@
+#pragma once
+
+/// Compiled-in time zones from the IANA time zone database.
+///
+/// Each zone is a flash-resident table of UTC transition instants, generated
+/// from TZif data by `tools/tzdb_gen.py`, followed by the zone's POSIX TZ rule
+/// (from the TZif footer), which applies after the end of the table. The
+/// generated zones are declared in `roo_time/tzdb/zones.h`, in namespace
+/// `roo_time::tzdb` (e.g. `tzdb::Europe_Warsaw`). Regenerate the tables to
+/// change the set of zones or the covered range of years.
+///
+/// Example:
+///
+/// ```cpp
+/// #include "roo_time/tzdb/zones.h"
+///
+/// DateTime now(clock.now(), tzdb::Europe_Warsaw);
+/// ```
+
+#include <stddef.h>
+
+#include "roo_time.h"
+#include "roo_time/posix_tz.h"
+
+namespace roo_time {
+
+/// Time zone defined by a table of UTC offset transitions.
+///
+/// Lookups perform a binary search over the transitions, i.e. O(log n). The
+/// tables are not copied; they must outlive this object (which is naturally
+/// the case for the generated, static tables).
+///
+/// Past the end of the table, lookups evaluate the POSIX TZ rule, if any,
+/// parsing it on each call; this is slower, but keeps the daylight saving
+/// transitions going beyond the generated range of years.
+class TzdbTimeZone : public TimeZoneRules {
+ public:
+  /// Creates the zone from the specified tables.
+  ///
+  /// @param name IANA name of the zone, e.g. "Europe/Warsaw".
+  /// @param transitions Instants, in seconds since Epoch, at which the UTC
+  ///     offset changes, sorted in increasing order.
+  /// @param offsets_minutes UTC offsets, in minutes. Has `transition_count + 1`
+  ///     elements: the offset before the first transition, followed by the
+  ///     offset in effect after each transition.
+  /// @param transition_count Number of elements in `transitions`.
+  /// @param table_end Instant, in seconds since Epoch, up to which (exclusive)
+  ///     the table is complete.
+  /// @param posix_rule POSIX TZ rule (e.g. "CET-1CEST,M3.5.0,M10.5.0/3") in
+  ///     effect from `table_end` on, or nullptr if unknown.
+  constexpr TzdbTimeZone(const char* name, const int32_t* transitions,
+                         const int16_t* offsets_minutes,
+                         uint16_t transition_count, int32_t table_end,
+                         const char* posix_rule)
+      : name_(name),
+        transitions_(transitions),
+        offsets_minutes_(offsets_minutes),
+        transition_count_(transition_count),
+        table_end_(table_end),
+        posix_rule_(posix_rule) {}
+
+  /// Returns the IANA name of this zone.
+  [[nodiscard]] const char* name() const { return name_; }
+
+  /// Returns the number of transitions in the table.
+  [[nodiscard]] uint16_t transitionCount() const { return transition_count_; }
+
+  /// Returns the instant of the transition at index `i`.
+  [[nodiscard]] WallTime transition(uint16_t i) const {
+    return WallTime(Seconds(transitions_[i]));
+  }
+
+  /// Returns the instant up to which (exclusive) the transition table is
+  /// complete.
+  [[nodiscard]] WallTime tableEnd() const {
+    return WallTime(Seconds(table_end_));
+  }
+
+  /// Returns the POSIX TZ rule in effect after `tableEnd()`, or nullptr if
+  /// unknown.
+  [[nodiscard]] const char* posixRule() const { return posix_rule_; }
+
+  /// Returns true if offsets at instant `t` are known: either `t` is before
+  /// `tableEnd()`, or the zone has a valid POSIX TZ rule.
+  [[nodiscard]] bool covers(WallTime t) const;
+
+  /// Returns the UTC offset in effect at instant `t`.
+  ///
+  /// Instants before the first transition use the initial offset. Instants
+  /// from `tableEnd()` on use the POSIX TZ rule; if there is none (see
+  /// `covers()`), they use the offset after the last transition.
+  TimeZone timeZoneAt(WallTime t) const override;
+
+  /// Finds the first offset change in (`lo`, `hi`]. Takes a binary search
+  /// over the table, and evaluates the POSIX TZ rule past its end.
+  bool transitionBetween(WallTime lo, WallTime hi,
+                         WallTime* transition) const override;
+
+ private:
+  // Returns the number of transitions at or before `seconds` since Epoch.
+  uint16_t transitionsUpTo(int64_t seconds) const;
+
+  // Parses the POSIX TZ rule into `zone`. Returns false if there is no valid
+  // rule.
+  bool posixZone(PosixTimeZone* zone) const;
+
+  const char* name_;
+  const int32_t* transitions_;
+  const int16_t* offsets_minutes_;
+  uint16_t transition_count_;
+  int32_t table_end_;
+  const char* posix_rule_;
+};
+
+/// Returns the compiled-in zone with the specified IANA name, or nullptr if
+/// there is no such zone.
+const TzdbTimeZone* FindTzdbZone(const char* name);
+
+namespace internal {
+
+// Defined in the generated roo_time/tzdb/zones.cpp.
+extern const TzdbTimeZone* const kTzdbZones[];
+extern const uint16_t kTzdbZoneCount;
+
+}  // namespace internal
+
+}  // namespace roo_time
@@ -0,0 +1,492 @@
+// Generated by tools/tzdb_gen.py from tzdata 2025b. DO NOT EDIT.
+
+#include "roo_time/tzdb/zones.h"
+
+namespace roo_time {
+namespace tzdb {
+
+namespace {
+
+constexpr int32_t kAmerica_ChicagoTransitions[] = {
+    9964800, 25686000, 41414400, 57740400, 73468800, 89190000,
+    104918400, 120639600, 126691200, 152089200, 162374400, 183538800,
+    199267200, 215593200, 230716800, 247042800, 262771200, 278492400,
+    294220800, 309942000, 325670400, 341391600, 357120000, 372841200,
+    388569600, 404895600, 420019200, 436345200, 452073600, 467794800,
+    483523200, 499244400, 514972800, 530694000, 544608000, 562143600,
+    576057600, 594198000, 607507200, 625647600, 638956800, 657097200,
+    671011200, 688546800, 702460800, 719996400, 733910400, 752050800,
+    765360000, 783500400, 796809600, 814950000, 828864000, 846399600,
+    860313600, 877849200, 891763200, 909298800, 923212800, 941353200,
+    954662400, 972802800, 986112000, 1004252400, 1018166400, 1035702000,
+    1049616000, 1067151600, 1081065600, 1099206000, 1112515200, 1130655600,
+    1143964800, 1162105200, 1173600000, 1194159600, 1205049600, 1225609200,
+    1236499200, 1257058800, 1268553600, 1289113200, 1300003200, 1320562800,
+    1331452800, 1352012400, 1362902400, 1383462000, 1394352000, 1414911600,
+    1425801600, 1446361200, 1457856000, 1478415600, 1489305600, 1509865200,
+    1520755200, 1541314800, 1552204800, 1572764400, 1583654400, 1604214000,
+    1615708800, 1636268400, 1647158400, 1667718000, 1678608000, 1699167600,
+    1710057600, 1730617200, 1741507200, 1762066800, 1772956800, 1793516400,
+    1805011200, 1825570800, 1836460800, 1857020400, 1867910400, 1888470000,
+    1899360000, 1919919600, 1930809600, 1951369200, 1962864000, 1983423600,
+    1994313600, 2014873200, 2025763200, 2046322800, 2057212800, 2077772400,
+    2088662400, 2109222000, 2120112000, 2140671600,
+};
+
+constexpr int16_t kAmerica_ChicagoOffsets[] = {
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360, -300, -360, -300, -360, -300, -360, -300,
+    -360, -300, -360, -300, -360,
+};
+
+constexpr int32_t kAmerica_DenverTransitions[] = {
+    9968400, 25689600, 41418000, 57744000, 73472400, 89193600,
+    104922000, 120643200, 126694800, 152092800, 162378000, 183542400,
+    199270800, 215596800, 230720400, 247046400, 262774800, 278496000,
+    294224400, 309945600, 325674000, 341395200, 357123600, 372844800,
+    388573200, 404899200, 420022800, 436348800, 452077200, 467798400,
+    483526800, 499248000, 514976400, 530697600, 544611600, 562147200,
+    576061200, 594201600, 607510800, 625651200, 638960400, 657100800,
+    671014800, 688550400, 702464400, 720000000, 733914000, 752054400,
+    765363600, 783504000, 796813200, 814953600, 828867600, 846403200,
+    860317200, 877852800, 891766800, 909302400, 923216400, 941356800,
+    954666000, 972806400, 986115600, 1004256000, 1018170000, 1035705600,
+    1049619600, 1067155200, 1081069200, 1099209600, 1112518800, 1130659200,
+    1143968400, 1162108800, 1173603600, 1194163200, 1205053200, 1225612800,
+    1236502800, 1257062400, 1268557200, 1289116800, 1300006800, 1320566400,
+    1331456400, 1352016000, 1362906000, 1383465600, 1394355600, 1414915200,
+    1425805200, 1446364800, 1457859600, 1478419200, 1489309200, 1509868800,
+    1520758800, 1541318400, 1552208400, 1572768000, 1583658000, 1604217600,
+    1615712400, 1636272000, 1647162000, 1667721600, 1678611600, 1699171200,
+    1710061200, 1730620800, 1741510800, 1762070400, 1772960400, 1793520000,
+    1805014800, 1825574400, 1836464400, 1857024000, 1867914000, 1888473600,
+    1899363600, 1919923200, 1930813200, 1951372800, 1962867600, 1983427200,
+    1994317200, 2014876800, 2025766800, 2046326400, 2057216400, 2077776000,
+    2088666000, 2109225600, 2120115600, 2140675200,
+};
+
+constexpr int16_t kAmerica_DenverOffsets[] = {
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420, -360, -420, -360, -420, -360, -420, -360,
+    -420, -360, -420, -360, -420,
+};
+
+constexpr int32_t kAmerica_Los_AngelesTransitions[] = {
+    9972000, 25693200, 41421600, 57747600, 73476000, 89197200,
+    104925600, 120646800, 126698400, 152096400, 162381600, 183546000,
+    199274400, 215600400, 230724000, 247050000, 262778400, 278499600,
+    294228000, 309949200, 325677600, 341398800, 357127200, 372848400,
+    388576800, 404902800, 420026400, 436352400, 452080800, 467802000,
+    483530400, 499251600, 514980000, 530701200, 544615200, 562150800,
+    576064800, 594205200, 607514400, 625654800, 638964000, 657104400,
+    671018400, 688554000, 702468000, 720003600, 733917600, 752058000,
+    765367200, 783507600, 796816800, 814957200, 828871200, 846406800,
+    860320800, 877856400, 891770400, 909306000, 923220000, 941360400,
+    954669600, 972810000, 986119200, 1004259600, 1018173600, 1035709200,
+    1049623200, 1067158800, 1081072800, 1099213200, 1112522400, 1130662800,
+    1143972000, 1162112400, 1173607200, 1194166800, 1205056800, 1225616400,
+    1236506400, 1257066000, 1268560800, 1289120400, 1300010400, 1320570000,
+    1331460000, 1352019600, 1362909600, 1383469200, 1394359200, 1414918800,
+    1425808800, 1446368400, 1457863200, 1478422800, 1489312800, 1509872400,
+    1520762400, 1541322000, 1552212000, 1572771600, 1583661600, 1604221200,
+    1615716000, 1636275600, 1647165600, 1667725200, 1678615200, 1699174800,
+    1710064800, 1730624400, 1741514400, 1762074000, 1772964000, 1793523600,
+    1805018400, 1825578000, 1836468000, 1857027600, 1867917600, 1888477200,
+    1899367200, 1919926800, 1930816800, 1951376400, 1962871200, 1983430800,
+    1994320800, 2014880400, 2025770400, 2046330000, 2057220000, 2077779600,
+    2088669600, 2109229200, 2120119200, 2140678800,
+};
+
+constexpr int16_t kAmerica_Los_AngelesOffsets[] = {
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480,
+};
+
+constexpr int32_t kAmerica_New_YorkTransitions[] = {
+    9961200, 25682400, 41410800, 57736800, 73465200, 89186400,
+    104914800, 120636000, 126687600, 152085600, 162370800, 183535200,
+    199263600, 215589600, 230713200, 247039200, 262767600, 278488800,
+    294217200, 309938400, 325666800, 341388000, 357116400, 372837600,
+    388566000, 404892000, 420015600, 436341600, 452070000, 467791200,
+    483519600, 499240800, 514969200, 530690400, 544604400, 562140000,
+    576054000, 594194400, 607503600, 625644000, 638953200, 657093600,
+    671007600, 688543200, 702457200, 719992800, 733906800, 752047200,
+    765356400, 783496800, 796806000, 814946400, 828860400, 846396000,
+    860310000, 877845600, 891759600, 909295200, 923209200, 941349600,
+    954658800, 972799200, 986108400, 1004248800, 1018162800, 1035698400,
+    1049612400, 1067148000, 1081062000, 1099202400, 1112511600, 1130652000,
+    1143961200, 1162101600, 1173596400, 1194156000, 1205046000, 1225605600,
+    1236495600, 1257055200, 1268550000, 1289109600, 1299999600, 1320559200,
+    1331449200, 1352008800, 1362898800, 1383458400, 1394348400, 1414908000,
+    1425798000, 1446357600, 1457852400, 1478412000, 1489302000, 1509861600,
+    1520751600, 1541311200, 1552201200, 1572760800, 1583650800, 1604210400,
+    1615705200, 1636264800, 1647154800, 1667714400, 1678604400, 1699164000,
+    1710054000, 1730613600, 1741503600, 1762063200, 1772953200, 1793512800,
+    1805007600, 1825567200, 1836457200, 1857016800, 1867906800, 1888466400,
+    1899356400, 1919916000, 1930806000, 1951365600, 1962860400, 1983420000,
+    1994310000, 2014869600, 2025759600, 2046319200, 2057209200, 2077768800,
+    2088658800, 2109218400, 2120108400, 2140668000,
+};
+
+constexpr int16_t kAmerica_New_YorkOffsets[] = {
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300,
+};
+
+constexpr int32_t kAmerica_Sao_PauloTransitions[] = {
+    499748400, 511236000, 530593200, 540266400, 562129200, 571197600,
+    592974000, 602042400, 624423600, 634701600, 656478000, 666756000,
+    687927600, 697600800, 719982000, 728445600, 750826800, 761709600,
+    782276400, 793159200, 813726000, 824004000, 844570800, 856058400,
+    876106800, 888717600, 908074800, 919562400, 938919600, 951616800,
+    970974000, 982461600, 1003028400, 1013911200, 1036292400, 1045360800,
+    1066532400, 1076810400, 1099364400, 1108864800, 1129431600, 1140314400,
+    1162695600, 1172368800, 1192330800, 1203213600, 1224385200, 1234663200,
+    1255834800, 1266717600, 1287284400, 1298167200, 1318734000, 1330221600,
+    1350788400, 1361066400, 1382238000, 1392516000, 1413687600, 1424570400,
+    1445137200, 1456020000, 1476586800, 1487469600, 1508036400, 1518919200,
+    1541300400, 1550368800,
+};
+
+constexpr int16_t kAmerica_Sao_PauloOffsets[] = {
+    -180, -120, -180, -120, -180, -120, -180, -120, -180, -120, -180, -120,
+    -180, -120, -180, -120, -180, -120, -180, -120, -180, -120, -180, -120,
+    -180, -120, -180, -120, -180, -120, -180, -120, -180, -120, -180, -120,
+    -180, -120, -180, -120, -180, -120, -180, -120, -180, -120, -180, -120,
+    -180, -120, -180, -120, -180, -120, -180, -120, -180, -120, -180, -120,
+    -180, -120, -180, -120, -180, -120, -180, -120, -180,
+};
+
+constexpr int16_t kAsia_KolkataOffsets[] = {
+    330,
+};
+
+constexpr int32_t kAsia_ShanghaiTransitions[] = {
+    515527200, 527014800, 545162400, 558464400, 577216800, 589914000,
+    608666400, 621968400, 640116000, 653418000, 671565600, 684867600,
+};
+
+constexpr int16_t kAsia_ShanghaiOffsets[] = {
+    480, 540, 480, 540, 480, 540, 480, 540, 480, 540, 480, 540,
+    480,
+};
+
+constexpr int16_t kAsia_TokyoOffsets[] = {
+    540,
+};
+
+constexpr int32_t kAustralia_SydneyTransitions[] = {
+    57686400, 67968000, 89136000, 100022400, 120585600, 131472000,
+    152035200, 162921600, 183484800, 194976000, 215539200, 226425600,
+    246988800, 257875200, 278438400, 289324800, 309888000, 320774400,
+    341337600, 352224000, 372787200, 386697600, 404841600, 415728000,
+    436291200, 447177600, 467740800, 478627200, 499190400, 511286400,
+    530035200, 542736000, 562089600, 574790400, 594144000, 606240000,
+    625593600, 636480000, 657043200, 667929600, 688492800, 699379200,
+    719942400, 731433600, 751996800, 762883200, 783446400, 794332800,
+    814896000, 828201600, 846345600, 859651200, 877795200, 891100800,
+    909244800, 922550400, 941299200, 954000000, 967305600, 985449600,
+    1004198400, 1017504000, 1035648000, 1048953600, 1067097600, 1080403200,
+    1099152000, 1111852800, 1130601600, 1143907200, 1162051200, 1174752000,
+    1193500800, 1207411200, 1223136000, 1238860800, 1254585600, 1270310400,
+    1286035200, 1301760000, 1317484800, 1333209600, 1349539200, 1365264000,
+    1380988800, 1396713600, 1412438400, 1428163200, 1443888000, 1459612800,
+    1475337600, 1491062400, 1506787200, 1522512000, 1538841600, 1554566400,
+    1570291200, 1586016000, 1601740800, 1617465600, 1633190400, 1648915200,
+    1664640000, 1680364800, 1696089600, 1712419200, 1728144000, 1743868800,
+    1759593600, 1775318400, 1791043200, 1806768000, 1822492800, 1838217600,
+    1853942400, 1869667200, 1885996800, 1901721600, 1917446400, 1933171200,
+    1948896000, 1964620800, 1980345600, 1996070400, 2011795200, 2027520000,
+    2043244800, 2058969600, 2075299200, 2091024000, 2106748800, 2122473600,
+    2138198400,
+};
+
+constexpr int16_t kAustralia_SydneyOffsets[] = {
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660,
+    600, 660,
+};
+
+constexpr int32_t kEurope_BerlinTransitions[] = {
+    323830800, 338950800, 354675600, 370400400, 386125200, 401850000,
+    417574800, 433299600, 449024400, 465354000, 481078800, 496803600,
+    512528400, 528253200, 543978000, 559702800, 575427600, 591152400,
+    606877200, 622602000, 638326800, 654656400, 670381200, 686106000,
+    701830800, 717555600, 733280400, 749005200, 764730000, 780454800,
+    796179600, 811904400, 828234000, 846378000, 859683600, 877827600,
+    891133200, 909277200, 922582800, 941331600, 954032400, 972781200,
+    985482000, 1004230800, 1017536400, 1035680400, 1048986000, 1067130000,
+    1080435600, 1099184400, 1111885200, 1130634000, 1143334800, 1162083600,
+    1174784400, 1193533200, 1206838800, 1224982800, 1238288400, 1256432400,
+    1269738000, 1288486800, 1301187600, 1319936400, 1332637200, 1351386000,
+    1364691600, 1382835600, 1396141200, 1414285200, 1427590800, 1445734800,
+    1459040400, 1477789200, 1490490000, 1509238800, 1521939600, 1540688400,
+    1553994000, 1572138000, 1585443600, 1603587600, 1616893200, 1635642000,
+    1648342800, 1667091600, 1679792400, 1698541200, 1711846800, 1729990800,
+    1743296400, 1761440400, 1774746000, 1792890000, 1806195600, 1824944400,
+    1837645200, 1856394000, 1869094800, 1887843600, 1901149200, 1919293200,
+    1932598800, 1950742800, 1964048400, 1982797200, 1995498000, 2014246800,
+    2026947600, 2045696400, 2058397200, 2077146000, 2090451600, 2108595600,
+    2121901200, 2140045200,
+};
+
+constexpr int16_t kEurope_BerlinOffsets[] = {
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60,
+};
+
+constexpr int32_t kEurope_LondonTransitions[] = {
+    57722400, 69818400, 89172000, 101268000, 120621600, 132717600,
+    152071200, 164167200, 183520800, 196221600, 214970400, 227671200,
+    246420000, 259120800, 278474400, 290570400, 309924000, 322020000,
+    341373600, 354675600, 372819600, 386125200, 404269200, 417574800,
+    435718800, 449024400, 467773200, 481078800, 499222800, 512528400,
+    530672400, 543978000, 562122000, 575427600, 593571600, 606877200,
+    625626000, 638326800, 657075600, 670381200, 688525200, 701830800,
+    719974800, 733280400, 751424400, 764730000, 782874000, 796179600,
+    814323600, 828234000, 846378000, 859683600, 877827600, 891133200,
+    909277200, 922582800, 941331600, 954032400, 972781200, 985482000,
+    1004230800, 1017536400, 1035680400, 1048986000, 1067130000, 1080435600,
+    1099184400, 1111885200, 1130634000, 1143334800, 1162083600, 1174784400,
+    1193533200, 1206838800, 1224982800, 1238288400, 1256432400, 1269738000,
+    1288486800, 1301187600, 1319936400, 1332637200, 1351386000, 1364691600,
+    1382835600, 1396141200, 1414285200, 1427590800, 1445734800, 1459040400,
+    1477789200, 1490490000, 1509238800, 1521939600, 1540688400, 1553994000,
+    1572138000, 1585443600, 1603587600, 1616893200, 1635642000, 1648342800,
+    1667091600, 1679792400, 1698541200, 1711846800, 1729990800, 1743296400,
+    1761440400, 1774746000, 1792890000, 1806195600, 1824944400, 1837645200,
+    1856394000, 1869094800, 1887843600, 1901149200, 1919293200, 1932598800,
+    1950742800, 1964048400, 1982797200, 1995498000, 2014246800, 2026947600,
+    2045696400, 2058397200, 2077146000, 2090451600, 2108595600, 2121901200,
+    2140045200,
+};
+
+constexpr int16_t kEurope_LondonOffsets[] = {
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+    60, 0,
+};
+
+constexpr int32_t kEurope_WarsawTransitions[] = {
+    228873600, 243993600, 260323200, 276048000, 291772800, 307497600,
+    323827200, 338947200, 354672000, 370396800, 386121600, 401846400,
+    417571200, 433296000, 449020800, 465350400, 481075200, 496800000,
+    512524800, 528249600, 543974400, 559699200, 575427600, 591152400,
+    606877200, 622602000, 638326800, 654656400, 670381200, 686106000,
+    701830800, 717555600, 733280400, 749005200, 764730000, 780454800,
+    796179600, 811904400, 828234000, 846378000, 859683600, 877827600,
+    891133200, 909277200, 922582800, 941331600, 954032400, 972781200,
+    985482000, 1004230800, 1017536400, 1035680400, 1048986000, 1067130000,
+    1080435600, 1099184400, 1111885200, 1130634000, 1143334800, 1162083600,
+    1174784400, 1193533200, 1206838800, 1224982800, 1238288400, 1256432400,
+    1269738000, 1288486800, 1301187600, 1319936400, 1332637200, 1351386000,
+    1364691600, 1382835600, 1396141200, 1414285200, 1427590800, 1445734800,
+    1459040400, 1477789200, 1490490000, 1509238800, 1521939600, 1540688400,
+    1553994000, 1572138000, 1585443600, 1603587600, 1616893200, 1635642000,
+    1648342800, 1667091600, 1679792400, 1698541200, 1711846800, 1729990800,
+    1743296400, 1761440400, 1774746000, 1792890000, 1806195600, 1824944400,
+    1837645200, 1856394000, 1869094800, 1887843600, 1901149200, 1919293200,
+    1932598800, 1950742800, 1964048400, 1982797200, 1995498000, 2014246800,
+    2026947600, 2045696400, 2058397200, 2077146000, 2090451600, 2108595600,
+    2121901200, 2140045200,
+};
+
+constexpr int16_t kEurope_WarsawOffsets[] = {
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60,
+};
+
+}  // namespace
+
+const TzdbTimeZone America_Chicago(
+    "America/Chicago",
+    kAmerica_ChicagoTransitions,
+    kAmerica_ChicagoOffsets,
+    136,
+    2145916800,
+    "CST6CDT,M3.2.0,M11.1.0");
+
+const TzdbTimeZone America_Denver(
+    "America/Denver",
+    kAmerica_DenverTransitions,
+    kAmerica_DenverOffsets,
+    136,
+    2145916800,
+    "MST7MDT,M3.2.0,M11.1.0");
+
+const TzdbTimeZone America_Los_Angeles(
+    "America/Los_Angeles",
+    kAmerica_Los_AngelesTransitions,
+    kAmerica_Los_AngelesOffsets,
+    136,
+    2145916800,
+    "PST8PDT,M3.2.0,M11.1.0");
+
+const TzdbTimeZone America_New_York(
+    "America/New_York",
+    kAmerica_New_YorkTransitions,
+    kAmerica_New_YorkOffsets,
+    136,
+    2145916800,
+    "EST5EDT,M3.2.0,M11.1.0");
+
+const TzdbTimeZone America_Sao_Paulo(
+    "America/Sao_Paulo",
+    kAmerica_Sao_PauloTransitions,
+    kAmerica_Sao_PauloOffsets,
+    68,
+    2145916800,
+    "<-03>3");
+
+const TzdbTimeZone Asia_Kolkata(
+    "Asia/Kolkata",
+    nullptr,
+    kAsia_KolkataOffsets,
+    0,
+    2145916800,
+    "IST-5:30");
+
+const TzdbTimeZone Asia_Shanghai(
+    "Asia/Shanghai",
+    kAsia_ShanghaiTransitions,
+    kAsia_ShanghaiOffsets,
+    12,
+    2145916800,
+    "CST-8");
+
+const TzdbTimeZone Asia_Tokyo(
+    "Asia/Tokyo",
+    nullptr,
+    kAsia_TokyoOffsets,
+    0,
+    2145916800,
+    "JST-9");
+
+const TzdbTimeZone Australia_Sydney(
+    "Australia/Sydney",
+    kAustralia_SydneyTransitions,
+    kAustralia_SydneyOffsets,
+    133,
+    2145916800,
+    "AEST-10AEDT,M10.1.0,M4.1.0/3");
+
+const TzdbTimeZone Europe_Berlin(
+    "Europe/Berlin",
+    kEurope_BerlinTransitions,
+    kEurope_BerlinOffsets,
+    116,
+    2145916800,
+    "CET-1CEST,M3.5.0,M10.5.0/3");
+
+const TzdbTimeZone Europe_London(
+    "Europe/London",
+    kEurope_LondonTransitions,
+    kEurope_LondonOffsets,
+    133,
+    2145916800,
+    "GMT0BST,M3.5.0/1,M10.5.0");
+
+const TzdbTimeZone Europe_Warsaw(
+    "Europe/Warsaw",
+    kEurope_WarsawTransitions,
+    kEurope_WarsawOffsets,
+    122,
+    2145916800,
+    "CET-1CEST,M3.5.0,M10.5.0/3");
+
+}  // namespace tzdb
+
+namespace internal {
+
+const TzdbTimeZone* const kTzdbZones[] = {
+    &tzdb::America_Chicago,
+    &tzdb::America_Denver,
+    &tzdb::America_Los_Angeles,
+    &tzdb::America_New_York,
+    &tzdb::America_Sao_Paulo,
+    &tzdb::Asia_Kolkata,
+    &tzdb::Asia_Shanghai,
+    &tzdb::Asia_Tokyo,
+    &tzdb::Australia_Sydney,
+    &tzdb::Europe_Berlin,
+    &tzdb::Europe_London,
+    &tzdb::Europe_Warsaw,
+};
+
+const uint16_t kTzdbZoneCount = 12;
+
+}  // namespace internal
+}  // namespace roo_time
@@ -0,0 +1,50 @@
+#pragma once
+
+// Generated by tools/tzdb_gen.py from tzdata 2025b. DO NOT EDIT.
+//
+// Transitions cover years 1970-2037; later instants are evaluated
+// from the POSIX TZ rules.
+
+#include "roo_time/tzdb.h"
+
+namespace roo_time {
+namespace tzdb {
+
+/// America/Chicago
+extern const TzdbTimeZone America_Chicago;
+
+/// America/Denver
+extern const TzdbTimeZone America_Denver;
+
+/// America/Los_Angeles
+extern const TzdbTimeZone America_Los_Angeles;
+
+/// America/New_York
+extern const TzdbTimeZone America_New_York;
+
+/// America/Sao_Paulo
+extern const TzdbTimeZone America_Sao_Paulo;
+
+/// Asia/Kolkata
+extern const TzdbTimeZone Asia_Kolkata;
+
+/// Asia/Shanghai
+extern const TzdbTimeZone Asia_Shanghai;
+
+/// Asia/Tokyo
+extern const TzdbTimeZone Asia_Tokyo;
+
+/// Australia/Sydney
+extern const TzdbTimeZone Australia_Sydney;
+
+/// Europe/Berlin
+extern const TzdbTimeZone Europe_Berlin;
+
+/// Europe/London
+extern const TzdbTimeZone Europe_London;
+
+/// Europe/Warsaw
+extern const TzdbTimeZone Europe_Warsaw;
+
+}  // namespace tzdb
+}  // namespace roo_time
@@ -0,0 +1,137 @@
+#pragma once
+
+/// Compact, 32-bit uptime and duration types, for large tables of timeouts.
+///
+/// `Uptime` and `Duration` take 8 bytes each. When deadlines are always within
+/// days of the current time, `Uptime32` and `Duration32` store them in half
+/// the space, at millisecond resolution:
+///
+/// ```
+/// Uptime32 deadline = Uptime32::Now() + Seconds(30);
+/// ...
+/// if (Uptime32::Now() >= deadline) { /* expired */ }
+/// ```
+
+#include <inttypes.h>
+
+#include "roo_time.h"
+#include "roo_time/basic_duration.h"
+
+namespace roo_time {
+
+/// Signed 32-bit count of milliseconds, covering about +/-24.8 days. Converts
+/// implicitly to `Duration`; conversion from `Duration` is explicit, and
+/// truncates to milliseconds. See `roo_time/basic_duration.h`.
+using Duration32 = MillisDuration32;
+
+/// Uptime, in milliseconds, stored modulo 2^32.
+///
+/// The counter wraps around every 49.7 days, so an `Uptime32` identifies an
+/// instant only relative to a nearby one. Comparisons and differences are
+/// wrap-around-safe (computed modulo 2^32, as in RFC 1982 serial number
+/// arithmetic), and are correct as long as the compared instants are less
+/// than 2^31 ms (about 24.8 days) apart. In particular, comparison is not
+/// transitive across larger spans, so do not sort by it.
+class Uptime32 {
+ public:
+  /// Constructs the uptime at device start (or any multiple of 2^32 ms after
+  /// it).
+  constexpr Uptime32() : millis_(0) {}
+
+  /// Converts from `Uptime`, truncating to milliseconds, and wrapping around.
+  constexpr explicit Uptime32(Uptime t) : millis_((uint32_t)t.inMillis()) {}
+
+  /// Returns the current uptime.
+  static Uptime32 Now() { return Uptime32(Uptime::Now()); }
+
+  /// Constructs from the low 32 bits of the uptime in milliseconds.
+  static constexpr Uptime32 FromRawMillis(uint32_t millis) {
+    return Uptime32(millis, 0);
+  }
+
+  /// Returns the low 32 bits of the uptime in milliseconds.
+  [[nodiscard]] constexpr uint32_t rawMillis() const { return millis_; }
+
+  /// Returns the full uptime represented by this value that is closest to
+  /// `reference` (e.g. `Uptime::Now()`). Exact if the actual uptime is
+  /// within 2^31 ms (about 24.8 days) of `reference`.
+  [[nodiscard]] constexpr Uptime toUptime(Uptime reference) const {
+    int64_t reference_millis = reference.inMillis();
+    int32_t delta = (int32_t)(millis_ - (uint32_t)reference_millis);
+    return Uptime::Start() + Millis(reference_millis + delta);
+  }
+
+  /// Shifts by `d`.
+  constexpr Uptime32& operator+=(Duration32 d) {
+    millis_ += (uint32_t)d.count();
+    return *this;
+  }
+
+  /// Shifts backwards by `d`.
+  constexpr Uptime32& operator-=(Duration32 d) {
+    millis_ -= (uint32_t)d.count();
+    return *this;
+  }
+
+  /// Shifts by `d`, truncated to milliseconds. Any duration can be added;
+  /// only its value modulo 2^32 ms matters.
+  constexpr Uptime32& operator+=(Duration d) {
+    millis_ += (uint32_t)d.inMillis();
+    return *this;
+  }
+
+  /// Shifts backwards by `d`, truncated to milliseconds.
+  constexpr Uptime32& operator-=(Duration d) {
+    millis_ -= (uint32_t)d.inMillis();
+    return *this;
+  }
+
+ private:
+  constexpr Uptime32(uint32_t millis, int) : millis_(millis) {}
+
+  uint32_t millis_;
+};
+
+/// Returns uptime shifted by duration.
+inline constexpr Uptime32 operator+(Uptime32 t, Duration32 d) {
+  return t += d;
+}
+
+/// Returns uptime shifted by duration, truncated to milliseconds.
+inline constexpr Uptime32 operator+(Uptime32 t, Duration d) { return t += d; }
+
+/// Returns uptime shifted backwards by duration.
+inline constexpr Uptime32 operator-(Uptime32 t, Duration32 d) {
+  return t -= d;
+}
+
+/// Returns uptime shifted backwards by duration, truncated to milliseconds.
+inline constexpr Uptime32 operator-(Uptime32 t, Duration d) { return t -= d; }
+
+/// Returns the time elapsed from `b` to `a`, which must be less than 2^31 ms
+/// apart.
+inline constexpr Duration32 operator-(Uptime32 a, Uptime32 b) {
+  return Duration32((int32_t)(a.rawMillis() - b.rawMillis()));
+}
+
+inline constexpr bool operator==(Uptime32 a, Uptime32 b) {
+  return a.rawMillis() == b.rawMillis();
+}
+
+inline constexpr bool operator!=(Uptime32 a, Uptime32 b) {
+  return a.rawMillis() != b.rawMillis();
+}
+
+/// Returns true if `a` is earlier than `b`, assuming that they are less than
+/// 2^31 ms apart.
+inline constexpr bool operator<(Uptime32 a, Uptime32 b) {
+  return (int32_t)(a.rawMillis() - b.rawMillis()) < 0;
+}
+
+inline constexpr bool operator>(Uptime32 a, Uptime32 b) { return b < a; }
+
+inline constexpr bool operator<=(Uptime32 a, Uptime32 b) { return !(b < a); }
+
+inline constexpr bool operator>=(Uptime32 a, Uptime32 b) { return !(a < b); }
+
+}  // namespace roo_time
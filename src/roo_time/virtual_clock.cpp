@@ -0,0 +1,68 @@
+#include "roo_time/virtual_clock.h"
+
+#if ROO_TIME_VIRTUAL_CLOCK
+
+namespace roo_time {
+
+VirtualClock::VirtualClock(Uptime start, int participants)
+    : micros_(start.inMicros()), participants_(participants) {}
+
+Uptime VirtualClock::now() const {
+  return Uptime::Start() + Micros(micros_.load(std::memory_order_acquire));
+}
+
+void VirtualClock::delayUntil(Uptime deadline) {
+  int64_t micros = deadline.inMicros();
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (micros <= micros_.load(std::memory_order_relaxed)) return;
+  pending_.insert(micros);
+  maybeJumpLocked();
+  wakeup_.wait(lock, [this, micros] {
+    return micros_.load(std::memory_order_relaxed) >= micros;
+  });
+}
+
+void VirtualClock::advance(Duration duration) {
+  if (duration <= Duration()) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  advanceLocked(SaturatingAdd(now(), duration).inMicros());
+}
+
+void VirtualClock::advanceTo(Uptime t) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (t.inMicros() <= micros_.load(std::memory_order_relaxed)) return;
+  advanceLocked(t.inMicros());
+}
+
+void VirtualClock::addParticipant() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++participants_;
+}
+
+void VirtualClock::removeParticipant() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  --participants_;
+  maybeJumpLocked();
+}
+
+int VirtualClock::waiting() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return (int)pending_.size();
+}
+
+void VirtualClock::advanceLocked(int64_t micros) {
+  micros_.store(micros, std::memory_order_release);
+  // The woken-up threads are no longer blocked, even before they actually
+  // get to run; this keeps the clock from jumping again in the meantime.
+  pending_.erase(pending_.begin(), pending_.upper_bound(micros));
+  wakeup_.notify_all();
+}
+
+void VirtualClock::maybeJumpLocked() {
+  if (pending_.empty() || (int)pending_.size() < participants_) return;
+  advanceLocked(*pending_.begin());
+}
+
+}  // namespace roo_time
+
+#endif  // ROO_TIME_VIRTUAL_CLOCK
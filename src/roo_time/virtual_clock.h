@@ -0,0 +1,118 @@
+#pragma once
+
+/// Simulated time, for fast, deterministic tests of time-dependent code.
+///
+/// ```
+/// VirtualClock clock;
+/// UptimeSource* previous = SetUptimeSource(&clock);
+/// Delay(Hours(5));  // Returns immediately; Uptime::Now() is 5h later.
+/// SetUptimeSource(previous);
+/// ```
+
+#include "roo_time.h"
+
+// When 1, provides `VirtualClock`, which requires `std::mutex` and
+// `std::condition_variable`. Defaults to 1 on Linux.
+#ifndef ROO_TIME_VIRTUAL_CLOCK
+#if defined(__linux__)
+#define ROO_TIME_VIRTUAL_CLOCK 1
+#else
+#define ROO_TIME_VIRTUAL_CLOCK 0
+#endif
+#endif
+
+#if ROO_TIME_VIRTUAL_CLOCK
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+
+namespace roo_time {
+
+/// An `UptimeSource` whose time only moves when the code under test waits.
+///
+/// A fixed set of participating threads (by default, just one) share the
+/// clock. Whenever all of them are blocked in `delayUntil()` (e.g. via
+/// `Delay()` or `DelayUntil()`), the clock jumps straight to the earliest
+/// pending deadline, and wakes up the threads waiting for it. A single
+/// participant thus never actually waits: each delay advances the clock.
+///
+/// With several participants, each must call `removeParticipant()` when it
+/// no longer delays (e.g. before exiting); otherwise, the others wait for it
+/// forever. The clock can also be advanced explicitly, by any thread, with
+/// `advance()` and `advanceTo()`.
+class VirtualClock : public UptimeSource {
+ public:
+  /// Creates the clock, set to `start`, shared by `participants` threads.
+  explicit VirtualClock(Uptime start = Uptime::Start(), int participants = 1);
+
+  VirtualClock(const VirtualClock&) = delete;
+  VirtualClock& operator=(const VirtualClock&) = delete;
+
+  /// Returns the current virtual uptime.
+  Uptime now() const override;
+
+  /// Blocks until the virtual uptime reaches `deadline`.
+  void delayUntil(Uptime deadline) override;
+
+  /// Advances the clock by `duration`, waking up the threads whose deadlines
+  /// have been reached.
+  void advance(Duration duration);
+
+  /// Advances the clock to `t`, waking up the threads whose deadlines have
+  /// been reached. No-op if `t` is not later than `now()`.
+  void advanceTo(Uptime t);
+
+  /// Registers one more participating thread.
+  void addParticipant();
+
+  /// Unregisters a participating thread. If all the remaining ones are
+  /// blocked, advances the clock.
+  void removeParticipant();
+
+  /// Returns the number of threads blocked in `delayUntil()`.
+  [[nodiscard]] int waiting() const;
+
+ private:
+  // Sets the time to `micros`, and wakes up the threads whose deadlines have
+  // been reached.
+  void advanceLocked(int64_t micros);
+
+  // Jumps to the earliest pending deadline if all participants are blocked.
+  void maybeJumpLocked();
+
+  mutable std::mutex mutex_;
+  std::condition_variable wakeup_;
+
+  // Written under mutex_; read without it in now().
+  std::atomic<int64_t> micros_;
+
+  // Deadlines of the blocked threads.
+  std::multiset<int64_t> pending_;
+  int participants_;
+};
+
+/// A `WallTimeClock` that follows a `VirtualClock`, e.g. to simulate the
+/// passing of days across DST transitions.
+class VirtualWallClock : public WallTimeClock {
+ public:
+  /// Creates the clock, reading `now` at the current time of `clock`, which
+  /// must outlive this object.
+  VirtualWallClock(const VirtualClock& clock, WallTime now)
+      : clock_(clock), start_uptime_(clock.now()), start_(now) {}
+
+  /// Returns the current virtual wall time.
+  WallTime now() const override {
+    return start_ + (clock_.now() - start_uptime_);
+  }
+
+ private:
+  const VirtualClock& clock_;
+  Uptime start_uptime_;
+  WallTime start_;
+};
+
+}  // namespace roo_time
+
+#endif  // ROO_TIME_VIRTUAL_CLOCK
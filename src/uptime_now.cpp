@@ -1,4 +1,8 @@
+#include <atomic>
+
 #include "roo_time.h"
+#include "roo_time/internal/overshoot_estimator.h"
+#include "roo_time/internal/uptime_extension.h"
 
 #if defined(ROO_TESTING)
 
@@ -65,7 +69,10 @@ inline static void __delayMicros(int64_t micros) {
 
 #include <Arduino.h>
 
-inline static int64_t __uptime() { return micros(); }
+// Wraps around every ~71.6 minutes.
+inline static uint32_t __uptime32() { return micros(); }
+
+#define ROO_TIME_UPTIME_32BIT 1
 
 inline static void __delayMicros(int64_t micros) {
   if (micros < 0) {
@@ -83,13 +90,46 @@ inline static void __delayMicros(int64_t micros) {
 #include <chrono>
 #include <thread>
 
+#include "roo_time/internal/tsc_clock.h"
+
+// When 1, and on x86-64 CPUs with an invariant TSC, reads the uptime from the
+// TSC, calibrated against CLOCK_MONOTONIC (see roo_time/internal/tsc_clock.h).
+// About twice as fast as CLOCK_MONOTONIC, but only as accurate as the
+// calibration (typically within a few microseconds). Defaults to 0.
+#ifndef ROO_TIME_LINUX_USE_TSC
+#define ROO_TIME_LINUX_USE_TSC 0
+#endif
+
+#if ROO_TIME_LINUX_USE_TSC && defined(ROO_TIME_TSC_CLOCK_AVAILABLE)
+
+static roo_time::internal::TscClock tsc_clock;
+
+inline static int64_t __uptime() { return tsc_clock.now(); }
+
+#else
+
+// CLOCK_MONOTONIC, unlike std::chrono::high_resolution_clock (which is the
+// system clock in libstdc++), does not jump on NTP or manual adjustments.
 inline static int64_t __uptime() {
-  auto now = std::chrono::high_resolution_clock::now();
-  return std::chrono::duration_cast<std::chrono::microseconds>(
-             now.time_since_epoch())
-      .count();
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#endif
+
+#define ROO_TIME_UPTIME_MONOTONE 1
+
+// The time of the last scheduler tick, read from the vDSO without touching
+// the clock hardware.
+inline static int64_t __uptime_coarse() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
 }
 
+#define ROO_TIME_UPTIME_COARSE 1
+
 inline static void __delayMicros(int64_t micros) {
   std::this_thread::sleep_for(std::chrono::microseconds(micros));
 }
@@ -106,31 +146,135 @@ namespace roo_time {
 #define ROO_TIME_UPTIME_MONOTONE 0
 #endif
 
+#ifndef ROO_TIME_UPTIME_32BIT
+#define ROO_TIME_UPTIME_32BIT 0
+#endif
+
+// Installed by SetUptimeSource(); nullptr when using the platform clock.
+static std::atomic<UptimeSource*> uptime_source(nullptr);
+
 #if ROO_TIME_UPTIME_MONOTONE
 
-const Uptime IRAM_ATTR Uptime::Now() { return Uptime(__uptime()); }
+inline static int64_t __uptime_micros() { return __uptime(); }
+
+#elif ROO_TIME_UPTIME_32BIT  // e.g. Arduino on RP2040.
+
+// Extends the wrapping 32-bit counter to 64 bits. Requires that Uptime::Now()
+// gets called at least once per half of the wrap-around period.
+static internal::CounterExtender32 extender;
+
+inline static int64_t __uptime_micros() {
+  return (int64_t)extender.extend([] { return __uptime32(); });
+}
+
+#else  // Sources that are not guaranteed to be monotone.
 
-#else  // e.g. on Arduino platforms with 32-bit millisecond resolution.
+// Makes sure the time is monotone.
+static internal::MonotoneAdjuster adjuster;
+
+inline static int64_t __uptime_micros() {
+  return adjuster.adjust([] { return __uptime(); });
+}
 
-static int64_t last_reading = 0;
+#endif
+
+#ifndef ROO_TIME_UPTIME_COARSE
+#define ROO_TIME_UPTIME_COARSE 0
+#endif
 
-// Offset to make sure the time is monotone.
-static int64_t offset = 0;
+#if !ROO_TIME_UPTIME_COARSE
+inline static int64_t __uptime_coarse() { return __uptime_micros(); }
+#endif
 
 const Uptime IRAM_ATTR Uptime::Now() {
-  int64_t now = __uptime() + offset;
-  int64_t diff = last_reading - now;
-  if (diff > 0) {
-    offset += diff;
-    now += diff;
-  }
-  last_reading = now;
-  return Uptime(now);
+  UptimeSource* source = uptime_source.load(std::memory_order_acquire);
+  if (source != nullptr) return source->now();
+  return Uptime(__uptime_micros());
+}
+
+const Uptime IRAM_ATTR Uptime::NowCoarse() {
+  UptimeSource* source = uptime_source.load(std::memory_order_acquire);
+  if (source != nullptr) return source->now();
+  return Uptime(__uptime_coarse());
 }
 
+// Maximum busy-wait per delay, in microseconds. See SetDelaySpinLimit().
+static std::atomic<int32_t> delay_spin_limit(0);
+
+// How late sleeps wake up.
+static internal::OvershootEstimator sleep_overshoot;
+
+inline static void __spinPause() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
 #endif
+}
 
-void IRAM_ATTR Delay(Duration duration) { __delayMicros(duration.inMicros()); }
-void IRAM_ATTR DelayUntil(Uptime deadline) { Delay(deadline - Uptime::Now()); }
+// Sleeps until shortly before `deadline` (by the expected overshoot, capped
+// at `spin_limit`), and busy-waits the rest.
+static void __preciseDelayUntil(int64_t deadline, int32_t spin_limit) {
+  int32_t lead = sleep_overshoot.lead();
+  if (lead > spin_limit) lead = spin_limit;
+  int64_t wake = deadline - lead;
+  int64_t now = __uptime_micros();
+  if (wake > now) {
+    __delayMicros(wake - now);
+    now = __uptime_micros();
+    sleep_overshoot.update(now - wake);
+  }
+  while (now < deadline) {
+    __spinPause();
+    now = __uptime_micros();
+  }
+}
+
+void IRAM_ATTR Delay(Duration duration) {
+  UptimeSource* source = uptime_source.load(std::memory_order_acquire);
+  if (source != nullptr) {
+    if (duration > Duration()) {
+      source->delayUntil(SaturatingAdd(source->now(), duration));
+    }
+    return;
+  }
+  int32_t spin_limit = delay_spin_limit.load(std::memory_order_relaxed);
+  if (spin_limit > 0 && duration > Duration()) {
+    __preciseDelayUntil(
+        internal::saturating_add(__uptime_micros(), duration.inMicros()),
+        spin_limit);
+    return;
+  }
+  __delayMicros(duration.inMicros());
+}
+
+void IRAM_ATTR DelayUntil(Uptime deadline) {
+  UptimeSource* source = uptime_source.load(std::memory_order_acquire);
+  if (source != nullptr) {
+    source->delayUntil(deadline);
+    return;
+  }
+  int32_t spin_limit = delay_spin_limit.load(std::memory_order_relaxed);
+  if (spin_limit > 0) {
+    __preciseDelayUntil(deadline.inMicros(), spin_limit);
+    return;
+  }
+  __delayMicros(deadline.inMicros() - __uptime_micros());
+}
+
+void SetDelaySpinLimit(Duration limit) {
+  int64_t micros = limit.inMicros();
+  if (micros < 0) micros = 0;
+  if (micros > INT32_MAX) micros = INT32_MAX;
+  delay_spin_limit.store((int32_t)micros, std::memory_order_relaxed);
+}
+
+Duration DelaySpinLimit() {
+  return Micros(delay_spin_limit.load(std::memory_order_relaxed));
+}
+
+Duration DelayOvershootEstimate() { return Micros(sleep_overshoot.mean()); }
+
+UptimeSource* SetUptimeSource(UptimeSource* source) {
+  return uptime_source.exchange(source, std::memory_order_acq_rel);
+}
 
 }  // namespace roo_time
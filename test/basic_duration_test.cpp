@@ -0,0 +1,207 @@
+#include "roo_time/basic_duration.h"
+
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+// Widening is implicit; narrowing is explicit.
+static_assert(std::is_convertible<MillisDuration, NanosDuration>::value, "");
+static_assert(!std::is_convertible<NanosDuration, MillisDuration>::value, "");
+static_assert(std::is_constructible<MillisDuration, NanosDuration>::value,
+              "");
+static_assert(std::is_convertible<MillisDuration32, MillisDuration>::value,
+              "");
+static_assert(!std::is_convertible<MillisDuration, MillisDuration32>::value,
+              "");
+static_assert(
+    !std::is_convertible<BasicDuration<uint32_t, std::milli>,
+                         BasicDuration<int32_t, std::milli>>::value,
+    "");
+static_assert(
+    std::is_convertible<BasicDuration<uint32_t, std::milli>,
+                        MillisDuration>::value,
+    "");
+static_assert(std::is_convertible<NanosDuration,
+                                  BasicDuration<double, std::ratio<1>>>::value,
+              "");
+
+// Interoperability with Duration.
+static_assert(std::is_convertible<Duration, MicrosDuration>::value, "");
+static_assert(std::is_convertible<MicrosDuration, Duration>::value, "");
+static_assert(std::is_convertible<Duration, NanosDuration>::value, "");
+static_assert(!std::is_convertible<NanosDuration, Duration>::value, "");
+static_assert(std::is_convertible<MillisDuration, Duration>::value, "");
+static_assert(!std::is_convertible<Duration, MillisDuration>::value, "");
+static_assert(std::is_convertible<MillisDuration32, Duration>::value, "");
+
+// Interoperability with Uptime and WallTime.
+static_assert(std::is_convertible<Uptime, MicrosUptime>::value, "");
+static_assert(std::is_convertible<MicrosUptime, Uptime>::value, "");
+static_assert(std::is_convertible<WallTime, NanosWallTime>::value, "");
+static_assert(!std::is_convertible<WallTime, SecondsWallTime>::value, "");
+static_assert(!std::is_convertible<WallTime, NanosUptime>::value, "");
+static_assert(!std::is_constructible<NanosUptime, NanosWallTime>::value, "");
+
+// Conversions are constant expressions.
+static_assert(NanosDuration(Millis(3)).count() == 3000000, "");
+static_assert(MillisDuration(NanosDuration(-2999999)).count() == -2, "");
+static_assert(TicksDuration<100>(MillisDuration(1234)).count() == 123, "");
+static_assert((MillisDuration(1) + NanosDuration(1)).count() == 1000001, "");
+static_assert(std::is_same<decltype(MillisDuration(1) + NanosDuration(1)),
+                           NanosDuration>::value,
+              "");
+static_assert(
+    std::is_same<decltype(TicksDuration<3>(1) + TicksDuration<2>(1)),
+                 BasicDuration<int64_t, std::ratio<1, 6>>>::value,
+    "");
+
+TEST(BasicDuration, Basics) {
+  NanosDuration d(2500);
+  EXPECT_EQ(2500, d.count());
+  EXPECT_EQ(0, NanosDuration().count());
+  EXPECT_EQ(0, NanosDuration::Zero().count());
+  EXPECT_EQ(INT64_MAX, NanosDuration::Max().count());
+  EXPECT_EQ(INT32_MIN, MillisDuration32::Min().count());
+  d += NanosDuration(500);
+  EXPECT_EQ(3000, d.count());
+  d -= NanosDuration(1000);
+  EXPECT_EQ(2000, d.count());
+  d *= 3;
+  EXPECT_EQ(6000, d.count());
+  d /= 4;
+  EXPECT_EQ(1500, d.count());
+  EXPECT_EQ(-1500, (-d).count());
+  EXPECT_EQ(3000, (d * 2).count());
+  EXPECT_EQ(3000, (2 * d).count());
+  EXPECT_EQ(750, (d / 2).count());
+  EXPECT_EQ(4, NanosDuration(7000) / d);
+}
+
+TEST(BasicDuration, Conversions) {
+  // Widening.
+  NanosDuration nanos = MillisDuration(5);
+  EXPECT_EQ(5000000, nanos.count());
+  MillisDuration millis = MillisDuration32(-7);
+  EXPECT_EQ(-7, millis.count());
+  // Narrowing truncates toward zero.
+  EXPECT_EQ(1, MillisDuration(NanosDuration(1999999)).count());
+  EXPECT_EQ(-1, MillisDuration(NanosDuration(-1999999)).count());
+  EXPECT_EQ(0, SecondsDuration(MillisDuration(-999)).count());
+  // Non-decimal periods.
+  EXPECT_EQ(1024, TicksDuration<1024>(SecondsDuration(1)).count());
+  EXPECT_EQ(999, MillisDuration(TicksDuration<1024>(1023)).count());
+  EXPECT_EQ(1023999,
+            (BasicDuration<int64_t, std::ratio<1, 1000>>(
+                 TicksDuration<1024, int32_t>(1048575)))
+                .count());
+  // Floating point.
+  BasicDuration<double, std::ratio<1>> seconds = MillisDuration(1500);
+  EXPECT_DOUBLE_EQ(1.5, seconds.count());
+  EXPECT_EQ(2500, MillisDuration(BasicDuration<double, std::ratio<1>>(2.5))
+                      .count());
+}
+
+TEST(BasicDuration, Duration) {
+  MicrosDuration micros = Millis(3);
+  EXPECT_EQ(3000, micros.count());
+  Duration d = micros;
+  EXPECT_EQ(3000, d.inMicros());
+  NanosDuration nanos = Micros(-5);
+  EXPECT_EQ(-5000, nanos.count());
+  EXPECT_EQ(-5, static_cast<Duration>(NanosDuration(-5999)).inMicros());
+  EXPECT_EQ(2, MillisDuration(Micros(2999)).count());
+  Duration from_millis = MillisDuration(7);
+  EXPECT_EQ(7000, from_millis.inMicros());
+  // Functions taking Duration accept lossless BasicDurations.
+  auto in_millis = [](Duration d) { return d.inMillis(); };
+  EXPECT_EQ(4000, in_millis(SecondsDuration(4)));
+  EXPECT_EQ(7, in_millis(micros + Micros(4000)));
+}
+
+TEST(BasicDuration, MixedArithmetic) {
+  auto sum = MillisDuration(1) + NanosDuration(1);
+  static_assert(std::is_same<decltype(sum), NanosDuration>::value, "");
+  EXPECT_EQ(1000001, sum.count());
+  EXPECT_EQ(999999, (MillisDuration(1) - NanosDuration(1)).count());
+  auto with_duration = MillisDuration(2) + Micros(3);
+  static_assert(std::is_same<decltype(with_duration), MicrosDuration>::value,
+                "");
+  EXPECT_EQ(2003, with_duration.count());
+  EXPECT_EQ(1001, (Micros(3) + MillisDuration(1) - Micros(2)).count());
+  EXPECT_EQ(2, MillisDuration(2) / Micros(999));
+  // Mixed storage types widen to the common type.
+  auto wide = MillisDuration32(INT32_MAX) + MillisDuration(1);
+  static_assert(std::is_same<decltype(wide), MillisDuration>::value, "");
+  EXPECT_EQ(2147483648LL, wide.count());
+}
+
+TEST(BasicDuration, Comparisons) {
+  EXPECT_TRUE(MillisDuration(1) == NanosDuration(1000000));
+  EXPECT_FALSE(MillisDuration(1) != NanosDuration(1000000));
+  EXPECT_TRUE(MillisDuration(1) < NanosDuration(1000001));
+  EXPECT_TRUE(MillisDuration(1) <= NanosDuration(1000000));
+  EXPECT_TRUE(MillisDuration(1) > NanosDuration(999999));
+  EXPECT_TRUE(MillisDuration(1) >= NanosDuration(1000000));
+  EXPECT_TRUE(MillisDuration(1) == Millis(1));
+  EXPECT_TRUE(Micros(999) < MillisDuration(1));
+  EXPECT_TRUE(NanosDuration(1) > Micros(0));
+  EXPECT_TRUE(MicrosDuration(5) == Micros(5));
+  EXPECT_TRUE(TicksDuration<3>(1) < TicksDuration<2>(1));
+  EXPECT_TRUE(TicksDuration<4>(2) == TicksDuration<2>(1));
+  // Unaffected: comparisons of Duration.
+  EXPECT_TRUE(Micros(1) < Micros(2));
+}
+
+TEST(BasicTimePoint, Uptime) {
+  Uptime start = Uptime::Start() + Seconds(10);
+  MicrosUptime micros = start;
+  EXPECT_EQ(10000000, micros.sinceEpoch().count());
+  NanosUptime nanos = start;
+  EXPECT_EQ(10000000000LL, nanos.sinceEpoch().count());
+  Uptime back = MillisUptime(MillisDuration(1500));
+  EXPECT_EQ(1500000, back.inMicros());
+  EXPECT_EQ(10, static_cast<Uptime>(NanosUptime(NanosDuration(10999)))
+                    .inMicros());
+  MillisUptime millis(nanos + NanosDuration(999999));
+  EXPECT_EQ(10000, millis.sinceEpoch().count());
+
+  auto later = nanos + MillisDuration(1);
+  static_assert(std::is_same<decltype(later), NanosUptime>::value, "");
+  EXPECT_EQ(10001000000LL, later.sinceEpoch().count());
+  EXPECT_EQ(later, MillisDuration(1) + nanos);
+  EXPECT_EQ(nanos, later - MillisDuration(1));
+  EXPECT_EQ(NanosDuration(1000000), later - nanos);
+  EXPECT_TRUE(nanos < later);
+  EXPECT_TRUE(later > start);
+  EXPECT_TRUE(start == nanos);
+  EXPECT_TRUE(millis <= nanos);
+  EXPECT_EQ(Millis(1), later - start);
+  auto shifted = start + NanosDuration(1);
+  static_assert(std::is_same<decltype(shifted), NanosUptime>::value, "");
+  EXPECT_EQ(10000000001LL, shifted.sinceEpoch().count());
+  nanos += NanosDuration(5);
+  nanos -= NanosDuration(2);
+  EXPECT_EQ(10000000003LL, nanos.sinceEpoch().count());
+  // Unaffected: Uptime arithmetic.
+  static_assert(std::is_same<decltype(start + Micros(1)), Uptime>::value, "");
+}
+
+TEST(BasicTimePoint, WallTime) {
+  WallTime t = DateTime(2024, 7, 1, timezone::UTC).wallTime() + Millis(250);
+  SecondsWallTime unix_time(t);
+  EXPECT_EQ(1719792000, unix_time.sinceEpoch().count());
+  NanosWallTime nanos = t;
+  EXPECT_EQ(1719792000250000000LL, nanos.sinceEpoch().count());
+  WallTime back = unix_time;
+  EXPECT_EQ(t - Millis(250), back);
+  EXPECT_EQ(Millis(250), nanos - unix_time);
+  EXPECT_TRUE(unix_time < t);
+  // Before the epoch, narrowing truncates toward the epoch.
+  EXPECT_EQ(-1,
+            SecondsWallTime(WallTime(Millis(-1500))).sinceEpoch().count());
+}
+
+}  // namespace roo_time
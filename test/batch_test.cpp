@@ -0,0 +1,145 @@
+#include "roo_time/batch.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+namespace {
+
+struct Columns {
+  explicit Columns(size_t n)
+      : year(n),
+        month(n),
+        day(n),
+        hour(n),
+        minute(n),
+        second(n),
+        micros(n),
+        day_of_week(n),
+        day_of_year(n) {}
+
+  CivilColumns out() {
+    CivilColumns c;
+    c.year = year.data();
+    c.month = month.data();
+    c.day = day.data();
+    c.hour = hour.data();
+    c.minute = minute.data();
+    c.second = second.data();
+    c.micros = micros.data();
+    c.day_of_week = day_of_week.data();
+    c.day_of_year = day_of_year.data();
+    return c;
+  }
+
+  std::vector<int16_t> year;
+  std::vector<uint8_t> month;
+  std::vector<uint8_t> day;
+  std::vector<uint8_t> hour;
+  std::vector<uint8_t> minute;
+  std::vector<uint8_t> second;
+  std::vector<uint32_t> micros;
+  std::vector<uint8_t> day_of_week;
+  std::vector<uint16_t> day_of_year;
+};
+
+void ExpectMatchesDateTime(const std::vector<WallTime>& input, TimeZone tz) {
+  Columns fast(input.size());
+  DecomposeWallTimes(input.data(), input.size(), tz, fast.out());
+  Columns reference(input.size());
+  DecomposeWallTimesScalar(input.data(), input.size(), tz, reference.out());
+  for (size_t i = 0; i < input.size(); ++i) {
+    DateTime dt(input[i], tz);
+    SCOPED_TRACE(dt);
+    EXPECT_EQ(dt.year(), fast.year[i]);
+    EXPECT_EQ(dt.month(), fast.month[i]);
+    EXPECT_EQ(dt.day(), fast.day[i]);
+    EXPECT_EQ(dt.hour(), fast.hour[i]);
+    EXPECT_EQ(dt.minute(), fast.minute[i]);
+    EXPECT_EQ(dt.second(), fast.second[i]);
+    EXPECT_EQ(dt.micros(), fast.micros[i]);
+    EXPECT_EQ(dt.dayOfWeek(), fast.day_of_week[i]);
+    EXPECT_EQ(dt.dayOfYear(), fast.day_of_year[i]);
+  }
+  EXPECT_EQ(reference.year, fast.year);
+  EXPECT_EQ(reference.month, fast.month);
+  EXPECT_EQ(reference.day, fast.day);
+  EXPECT_EQ(reference.hour, fast.hour);
+  EXPECT_EQ(reference.minute, fast.minute);
+  EXPECT_EQ(reference.second, fast.second);
+  EXPECT_EQ(reference.micros, fast.micros);
+  EXPECT_EQ(reference.day_of_week, fast.day_of_week);
+  EXPECT_EQ(reference.day_of_year, fast.day_of_year);
+}
+
+}  // namespace
+
+TEST(DecomposeWallTimes, Empty) {
+  DecomposeWallTimes(nullptr, 0, timezone::UTC, CivilColumns());
+}
+
+TEST(DecomposeWallTimes, KnownValue) {
+  WallTime t(Micros(1590443851000001));
+  Columns c(1);
+  DecomposeWallTimes(&t, 1, TimeZone(Hours(2)), c.out());
+  EXPECT_EQ(2020, c.year[0]);
+  EXPECT_EQ(kMay, c.month[0]);
+  EXPECT_EQ(25, c.day[0]);
+  EXPECT_EQ(23, c.hour[0]);
+  EXPECT_EQ(57, c.minute[0]);
+  EXPECT_EQ(31, c.second[0]);
+  EXPECT_EQ(1u, c.micros[0]);
+  EXPECT_EQ(kMonday, c.day_of_week[0]);
+  EXPECT_EQ(146, c.day_of_year[0]);
+}
+
+TEST(DecomposeWallTimes, PartialColumns) {
+  std::vector<WallTime> input;
+  for (int i = 0; i < 100; ++i) {
+    input.push_back(WallTime(Hours(i * 7) + Micros(i)));
+  }
+  std::vector<uint8_t> hour(input.size());
+  std::vector<uint8_t> dow(input.size());
+  CivilColumns out;
+  out.hour = hour.data();
+  out.day_of_week = dow.data();
+  DecomposeWallTimes(input.data(), input.size(), timezone::UTC, out);
+  for (size_t i = 0; i < input.size(); ++i) {
+    DateTime dt(input[i], timezone::UTC);
+    EXPECT_EQ(dt.hour(), hour[i]);
+    EXPECT_EQ(dt.dayOfWeek(), dow[i]);
+  }
+}
+
+TEST(DecomposeWallTimes, DayBoundaries) {
+  std::vector<WallTime> input;
+  for (int d = -800; d <= 800; ++d) {
+    WallTime midnight(Hours(24 * d));
+    input.push_back(midnight - Micros(1));
+    input.push_back(midnight);
+    input.push_back(midnight + Micros(1));
+  }
+  ExpectMatchesDateTime(input, timezone::UTC);
+  ExpectMatchesDateTime(input, TimeZone(Hours(2)));
+  ExpectMatchesDateTime(input, TimeZone(Minutes(-570)));
+}
+
+TEST(DecomposeWallTimes, Random) {
+  std::mt19937_64 gen(12345);
+  // Years 1000 to 3000.
+  std::uniform_int_distribution<int64_t> dist(-30610224000000000LL,
+                                              32503680000000000LL);
+  std::vector<WallTime> input;
+  for (int i = 0; i < 10000; ++i) {
+    input.push_back(WallTime(Micros(dist(gen))));
+  }
+  ExpectMatchesDateTime(input, timezone::UTC);
+  ExpectMatchesDateTime(input, TimeZone(Minutes(345)));
+  ExpectMatchesDateTime(input, TimeZone(Hours(-8)));
+}
+
+}  // namespace roo_time
@@ -0,0 +1,88 @@
+#include "roo_time/cached_timestamp_formatter.h"
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+#include "roo_time/date_time_format.h"
+
+namespace roo_time {
+
+namespace {
+
+std::string Format(CachedTimestampFormatter& formatter, WallTime t) {
+  char buf[CachedTimestampFormatter::kMaxLength + 1];
+  size_t len = formatter.format(t, buf, sizeof(buf));
+  return std::string(buf, len);
+}
+
+}  // namespace
+
+TEST(CachedTimestampFormatter, Basic) {
+  CachedTimestampFormatter formatter(TimeZone(Hours(2)));
+  WallTime t = DateTime(2024, 7, 1, 14, 5, 9, 250000, TimeZone(Hours(2)))
+                   .wallTime();
+  EXPECT_EQ("2024-07-01 14:05:09.250", Format(formatter, t));
+  EXPECT_EQ("2024-07-01 14:05:09.999", Format(formatter, t + Micros(749999)));
+  EXPECT_EQ("2024-07-01 14:05:10.000", Format(formatter, t + Micros(750000)));
+  // Going back in time.
+  EXPECT_EQ("2024-07-01 14:05:09.000", Format(formatter, t - Millis(250)));
+  EXPECT_EQ("2024-07-01 14:05:08.999", Format(formatter, t - Millis(251)));
+}
+
+TEST(CachedTimestampFormatter, Options) {
+  WallTime t = DateTime(2024, 7, 1, 14, 5, 9, 123456, timezone::UTC)
+                   .wallTime();
+  CachedTimestampFormatter seconds(timezone::UTC, 0, 'T');
+  EXPECT_EQ("2024-07-01T14:05:09", Format(seconds, t));
+  CachedTimestampFormatter micros(timezone::UTC, 6);
+  EXPECT_EQ("2024-07-01 14:05:09.123456", Format(micros, t));
+  EXPECT_EQ(timezone::UTC.offset(), micros.timeZone().offset());
+}
+
+TEST(CachedTimestampFormatter, BeforeEpoch) {
+  CachedTimestampFormatter formatter(timezone::UTC, 6);
+  EXPECT_EQ("1969-12-31 23:59:59.999999",
+            Format(formatter, WallTime(Micros(-1))));
+  EXPECT_EQ("1969-12-31 23:59:59.000000",
+            Format(formatter, WallTime(Micros(-1000000))));
+  EXPECT_EQ("1969-12-31 23:59:58.999999",
+            Format(formatter, WallTime(Micros(-1000001))));
+  WallTime t = DateTime(-32768, 1, 1, timezone::UTC).wallTime();
+  EXPECT_EQ("-32768-01-01 00:00:00.000000", Format(formatter, t));
+}
+
+TEST(CachedTimestampFormatter, SmallBuffer) {
+  CachedTimestampFormatter formatter;
+  char buf[24];
+  EXPECT_EQ(23u, formatter.format(WallTime(), buf, 24));
+  EXPECT_STREQ("1970-01-01 00:00:00.000", buf);
+  EXPECT_EQ(0u, formatter.format(WallTime(), buf, 23));
+  EXPECT_STREQ("", buf);
+  EXPECT_EQ(0u, formatter.format(WallTime(), buf, 0));
+  // Exact fit, smaller than kMaxLength + 1.
+  CachedTimestampFormatter micros(timezone::UTC, 6);
+  char exact[27];
+  EXPECT_EQ(26u, micros.format(WallTime(Micros(123456)), exact, 27));
+  EXPECT_STREQ("1970-01-01 00:00:00.123456", exact);
+}
+
+TEST(CachedTimestampFormatter, MatchesDateTimeFormat) {
+  constexpr DateTimeFormat kFormat("%F %T.%3f");
+  TimeZone tz(Minutes(-210));
+  CachedTimestampFormatter formatter(tz);
+  std::mt19937_64 gen(42);
+  // Mostly small steps, with occasional jumps back and forth.
+  std::uniform_int_distribution<int64_t> step(0, 300000);
+  std::uniform_int_distribution<int64_t> jump(-100000000000LL, 100000000000LL);
+  WallTime t = DateTime(2024, 12, 31, 23, 59, 0, 0, tz).wallTime();
+  for (int i = 0; i < 100000; ++i) {
+    t += Micros((i % 1000 == 0) ? jump(gen) : step(gen));
+    char expected[64];
+    kFormat.format(DateTime(t, tz), expected, sizeof(expected));
+    ASSERT_EQ(expected, Format(formatter, t));
+  }
+}
+
+}  // namespace roo_time
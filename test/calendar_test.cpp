@@ -0,0 +1,95 @@
+#include "roo_time/internal/calendar.h"
+
+#include "gtest/gtest.h"
+
+namespace roo_time {
+namespace internal {
+
+namespace {
+
+constexpr int32_t kMinYear = -32768;
+constexpr int32_t kMaxYear = 32767;
+
+uint8_t LastDayOfMonth(int32_t y, uint8_t m) {
+  constexpr uint8_t kDays[12] = {31, 28, 31, 30, 31, 30,
+                                 31, 31, 30, 31, 30, 31};
+  return (m == 2 && is_leap(y)) ? 29 : kDays[m - 1];
+}
+
+}  // namespace
+
+TEST(Calendar, KnownDates) {
+  EXPECT_EQ(0, days_from_civil(1970, 1, 1));
+  EXPECT_EQ(-1, days_from_civil(1969, 12, 31));
+  EXPECT_EQ(18406, days_from_civil(2020, 5, 24));
+  EXPECT_EQ(-719468, days_from_civil(0, 3, 1));
+  int16_t y;
+  uint8_t m;
+  uint8_t d;
+  civil_from_days(18406, &y, &m, &d);
+  EXPECT_EQ(2020, y);
+  EXPECT_EQ(5, m);
+  EXPECT_EQ(24, d);
+  civil_from_days(-1, &y, &m, &d);
+  EXPECT_EQ(1969, y);
+  EXPECT_EQ(12, m);
+  EXPECT_EQ(31, d);
+}
+
+// Walks every day of every supported year, checking that both algorithm
+// families agree with each other and with a simple day counter.
+TEST(Calendar, NeriSchneiderMatchesHinnantExhaustively) {
+  int32_t expected = days_from_civil_hinnant(kMinYear, 1, 1);
+  for (int32_t y = kMinYear; y <= kMaxYear; ++y) {
+    for (uint8_t m = 1; m <= 12; ++m) {
+      uint8_t last = LastDayOfMonth(y, m);
+      for (uint8_t d = 1; d <= last; ++d, ++expected) {
+        int32_t ns = days_from_civil_neri_schneider(y, m, d);
+        if (ns != expected ||
+            days_from_civil_hinnant(y, m, d) != expected) {
+          FAIL() << "days_from_civil mismatch at " << y << "-" << (int)m
+                 << "-" << (int)d << ": " << ns << " vs " << expected;
+        }
+        int16_t yy;
+        uint8_t mm;
+        uint8_t dd;
+        civil_from_days_neri_schneider(expected, &yy, &mm, &dd);
+        if (yy != y || mm != m || dd != d) {
+          FAIL() << "civil_from_days_neri_schneider(" << expected
+                 << ") = " << yy << "-" << (int)mm << "-" << (int)dd
+                 << ", expected " << y << "-" << (int)m << "-" << (int)d;
+        }
+        civil_from_days_hinnant(expected, &yy, &mm, &dd);
+        if (yy != y || mm != m || dd != d) {
+          FAIL() << "civil_from_days_hinnant(" << expected << ") = " << yy
+                 << "-" << (int)mm << "-" << (int)dd << ", expected " << y
+                 << "-" << (int)m << "-" << (int)d;
+        }
+      }
+    }
+  }
+  EXPECT_EQ(days_from_civil_hinnant(kMaxYear, 12, 31) + 1, expected);
+}
+
+TEST(Calendar, WeekdayFromDays) {
+  EXPECT_EQ(4, weekday_from_days(0));   // Thursday.
+  EXPECT_EQ(3, weekday_from_days(-1));  // Wednesday.
+  EXPECT_EQ(0, weekday_from_days(18406));
+  for (int32_t z = -100000; z < 100000; ++z) {
+    ASSERT_EQ((weekday_from_days(z) + 1) % 7, weekday_from_days(z + 1));
+  }
+}
+
+TEST(Calendar, FloorDivMod) {
+  EXPECT_EQ(-1, floor_div(-1, 24));
+  EXPECT_EQ(23, floor_mod(-1, 24));
+  EXPECT_EQ(-1, floor_div(-24, 24));
+  EXPECT_EQ(0, floor_mod(-24, 24));
+  EXPECT_EQ(-2, floor_div(-25, 24));
+  EXPECT_EQ(23, floor_mod(-25, 24));
+  EXPECT_EQ(1, floor_div(25, 24));
+  EXPECT_EQ(1, floor_mod(25, 24));
+}
+
+}  // namespace internal
+}  // namespace roo_time
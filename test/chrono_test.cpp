@@ -0,0 +1,83 @@
+#include "roo_time/chrono.h"
+
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+using namespace std::chrono_literals;
+
+static_assert(ToChrono(Millis(3)) == 3000us, "");
+static_assert(FromChrono(3ms) == Millis(3), "");
+static_assert(FromChrono(1999ns) == Micros(1), "");
+static_assert(FromChrono(-1999ns) == Micros(-1), "");
+static_assert(FromChrono(std::chrono::duration<double>(1.5)) == Millis(1500),
+              "");
+static_assert(ToChrono(NanosDuration(7)) == 7ns, "");
+static_assert(std::is_same<decltype(ToBasicDuration(5ns)), NanosDuration>::value,
+              "");
+static_assert(FromChrono(ToChrono(Uptime::Start() + Seconds(5))) ==
+                  Uptime::Start() + Seconds(5),
+              "");
+
+TEST(Chrono, Durations) {
+  EXPECT_EQ(std::chrono::microseconds(-12345), ToChrono(Micros(-12345)));
+  EXPECT_EQ(Duration::Max(),
+            FromChrono(std::chrono::microseconds::max()));
+  EXPECT_EQ(Hours(2), FromChrono(2h));
+  EXPECT_EQ(Micros(1500), FromChrono(1500999ns));
+  EXPECT_EQ(1500999, ToBasicDuration(1500999ns).count());
+  EXPECT_EQ(Micros(1500), Duration(MicrosDuration(ToBasicDuration(1500us))));
+}
+
+TEST(Chrono, WallTime) {
+  WallTime t = DateTime(2024, 7, 1, 12, 0, 0, 250001, timezone::UTC)
+                   .wallTime();
+  auto tp = ToChrono(t);
+  EXPECT_EQ(1719835200250001LL,
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                tp.time_since_epoch())
+                .count());
+  EXPECT_EQ(t, FromChrono(tp));
+  std::time_t time = std::chrono::system_clock::to_time_t(tp);
+  EXPECT_EQ(1719835200, time);
+  // The system clock reads close to SystemClock.
+  Duration diff =
+      FromChrono(std::chrono::system_clock::now()) - SystemClock().now();
+  EXPECT_LT(diff, Seconds(1));
+  EXPECT_GT(diff, Seconds(-1));
+}
+
+TEST(Chrono, UptimeClock) {
+  UptimeClock::time_point before = UptimeClock::now();
+  Uptime now = Uptime::Now();
+  UptimeClock::time_point after = UptimeClock::now();
+  EXPECT_LE(before, ToChrono(now));
+  EXPECT_LE(ToChrono(now), after);
+  EXPECT_EQ(now, FromChrono(ToChrono(now)));
+  // Works with chrono algorithms.
+  std::vector<UptimeClock::time_point> points = {after, before};
+  std::sort(points.begin(), points.end());
+  EXPECT_EQ(before, points.front());
+  auto rounded = std::chrono::floor<std::chrono::milliseconds>(ToChrono(now));
+  EXPECT_EQ(now.inMillis(), rounded.time_since_epoch().count());
+}
+
+TEST(Chrono, SteadyClock) {
+  Uptime now = Uptime::Now();
+  std::chrono::steady_clock::time_point steady = ToSteadyClock(now);
+  Duration error = FromChrono(steady) - now;
+  EXPECT_LT(error, Millis(10));
+  EXPECT_GT(error, Millis(-10));
+  Duration offset = FromChrono(std::chrono::steady_clock::now() + 1s) -
+                    (Uptime::Now() + Seconds(1));
+  EXPECT_LT(offset, Millis(10));
+  EXPECT_GT(offset, Millis(-10));
+}
+
+}  // namespace roo_time
@@ -0,0 +1,63 @@
+#include "roo_time/coarse_clock.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+TEST(CoarseClock, Tick) {
+  Uptime before = Uptime::Now();
+  CoarseClock clock;
+  Uptime after = Uptime::Now();
+  EXPECT_LE(before, clock.now());
+  EXPECT_LE(clock.now(), after);
+
+  Uptime constructed = clock.now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  // Doesn't advance without ticks.
+  EXPECT_EQ(constructed, clock.now());
+  before = Uptime::Now();
+  clock.tick();
+  after = Uptime::Now();
+  EXPECT_GE(clock.now() - constructed, Millis(5));
+  EXPECT_LE(before, clock.now());
+  EXPECT_LE(clock.now(), after);
+}
+
+#if ROO_TIME_COARSE_CLOCK_TICKER
+
+TEST(CoarseClock, StalenessBoundedByTickPeriod) {
+  const Duration kPeriod = Millis(1);
+  CoarseClock clock;
+  CoarseClockTicker ticker(clock, kPeriod);
+  Uptime deadline = Uptime::Now() + Millis(200);
+  Duration max_lag;
+  Uptime previous = clock.now();
+  while (Uptime::Now() < deadline) {
+    Uptime coarse = clock.now();
+    Uptime now = Uptime::Now();
+    // Never ahead, and never going backwards.
+    ASSERT_LE(coarse, now);
+    ASSERT_LE(previous, coarse);
+    previous = coarse;
+    if (now - coarse > max_lag) max_lag = now - coarse;
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  // The period, plus wake-up latency. Generous, for loaded machines.
+  EXPECT_LT(max_lag, kPeriod + Millis(50));
+  // Did get ticked.
+  EXPECT_GT(clock.now() - (deadline - Millis(200)), Millis(100));
+}
+
+TEST(CoarseClock, TickerStopsPromptly) {
+  CoarseClock clock;
+  Uptime start = Uptime::Now();
+  { CoarseClockTicker ticker(clock, Seconds(100)); }
+  EXPECT_LT(Uptime::Now() - start, Seconds(1));
+}
+
+#endif  // ROO_TIME_COARSE_CLOCK_TICKER
+
+}  // namespace roo_time
@@ -0,0 +1,56 @@
+#include "roo_time/date_time_converter.h"
+
+#include <random>
+
+#include "date_time_testing.h"
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+TEST(DateTimeConverter, MatchesDateTimeAcrossDayBoundaries) {
+  TimeZone tz(Hours(2));
+  DateTimeConverter converter(tz);
+  EXPECT_EQ(tz.offset(), converter.timeZone().offset());
+  // 2020-02-28 22:00 local, stepping by 7 minutes and 1 microsecond across
+  // two midnights and the leap day.
+  WallTime t = DateTime(2020, 2, 28, 22, 0, 0, 0, tz).wallTime();
+  for (int i = 0; i < 1000; ++i) {
+    SCOPED_TRACE(i);
+    ExpectSameFields(DateTime(t, tz), converter.convert(t));
+    t += Minutes(7) + Micros(1);
+  }
+}
+
+TEST(DateTimeConverter, ExactMidnight) {
+  DateTimeConverter converter;
+  WallTime midnight(Hours(24 * 18406));
+  ExpectSameFields(DateTime(midnight - Micros(1), timezone::UTC),
+                   converter.convert(midnight - Micros(1)));
+  ExpectSameFields(DateTime(midnight, timezone::UTC),
+                   converter.convert(midnight));
+  ExpectSameFields(DateTime(midnight - Micros(1), timezone::UTC),
+                   converter.convert(midnight - Micros(1)));
+}
+
+TEST(DateTimeConverter, BeforeEpoch) {
+  DateTimeConverter converter(TimeZone(Hours(-5)));
+  for (int64_t us = -3 * 86400000000LL; us < 86400000000LL;
+       us += 3599999999LL) {
+    WallTime t(Micros(us));
+    ExpectSameFields(DateTime(t, TimeZone(Hours(-5))), converter.convert(t));
+  }
+}
+
+TEST(DateTimeConverter, RandomOrder) {
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<int64_t> dist(0, 4 * 86400000000LL);
+  DateTimeConverter converter(TimeZone(Minutes(-150)));
+  for (int i = 0; i < 10000; ++i) {
+    WallTime t(Micros(1600000000000000LL + dist(gen)));
+    ExpectSameFields(DateTime(t, TimeZone(Minutes(-150))),
+                     converter.convert(t));
+  }
+}
+
+}  // namespace roo_time
@@ -0,0 +1,137 @@
+#include "roo_time/date_time_format.h"
+
+#include <time.h>
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+namespace {
+
+std::string Format(const DateTimeFormat& format, const DateTime& dt) {
+  EXPECT_TRUE(format.ok());
+  char buf[256];
+  size_t len = format.format(dt, buf, sizeof(buf));
+  EXPECT_LE(len, format.maxLength());
+  return std::string(buf, len);
+}
+
+std::string Format(const char* pattern, const DateTime& dt) {
+  return Format(DateTimeFormat(pattern), dt);
+}
+
+constexpr DateTimeFormat kCompileTime("%d.%m.%Y %H:%M");
+static_assert(kCompileTime.ok(), "Should compile");
+static_assert(kCompileTime.maxLength() == 18, "Unexpected max length");
+static_assert(!DateTimeFormat("%Q").ok(), "Unsupported conversion");
+static_assert(!DateTimeFormat("100%").ok(), "Trailing '%'");
+static_assert(!DateTimeFormat("%7f").ok(), "Too many fraction digits");
+static_assert(!DateTimeFormat("%3d").ok(), "Width on non-fraction");
+static_assert(!DateTimeFormat("%:m").ok(), "Colon on non-offset");
+static_assert(!DateTimeFormat("0123456789012345678901234567890123456789"
+                             "012345678901234567890123456789")
+                   .ok(),
+              "Too long");
+
+}  // namespace
+
+TEST(DateTimeFormat, Basic) {
+  DateTime dt(2024, 7, 1, 14, 5, 9, 250000, TimeZone(Hours(2)));
+  EXPECT_EQ("01.07.2024 14:05", Format(kCompileTime, dt));
+  EXPECT_EQ("2024-07-01T14:05:09.250000+0200",
+            Format("%Y-%m-%dT%H:%M:%S.%f%z", dt));
+  EXPECT_EQ("2024-07-01 14:05:09.250+02:00", Format("%F %T.%3f%:z", dt));
+  EXPECT_EQ("07/01/24 14:05", Format("%D %R", dt));
+  EXPECT_EQ("Monday, July  1; Mon Jul; day 183; 1/1",
+            Format("%A, %B %e; %a %b; day %j; %u/%w", dt));
+  EXPECT_EQ("02:05 PM", Format("%I:%M %p", dt));
+  EXPECT_EQ("100%", Format("100%%", dt));
+  EXPECT_EQ("", Format("", dt));
+}
+
+TEST(DateTimeFormat, TwelveHourClock) {
+  EXPECT_EQ("12 AM",
+            Format("%I %p", DateTime(2024, 7, 1, 0, 30, 0, 0, timezone::UTC)));
+  EXPECT_EQ("11 AM",
+            Format("%I %p", DateTime(2024, 7, 1, 11, 0, 0, 0, timezone::UTC)));
+  EXPECT_EQ("12 PM",
+            Format("%I %p", DateTime(2024, 7, 1, 12, 0, 0, 0, timezone::UTC)));
+  EXPECT_EQ("11 PM",
+            Format("%I %p", DateTime(2024, 7, 1, 23, 0, 0, 0, timezone::UTC)));
+}
+
+TEST(DateTimeFormat, NegativeOffset) {
+  DateTime dt(2024, 7, 1, 0, 0, 0, 0, TimeZone(Minutes(-570)));
+  EXPECT_EQ("-0930 -09:30", Format("%z %:z", dt));
+}
+
+TEST(DateTimeFormat, OutOfRangeOffset) {
+  // Only two digits of hours fit.
+  DateTimeFormat format("%H:%M %z");
+  char buf[64] = "x";
+  EXPECT_EQ(0u, format.format(DateTime(WallTime(), TimeZone(Hours(120))), buf,
+                              sizeof(buf)));
+  EXPECT_STREQ("", buf);
+  buf[0] = 'x';
+  EXPECT_EQ(0u, DateTimeFormat("%:z").format(
+                    DateTime(WallTime(), TimeZone(Minutes(-32768))), buf,
+                    sizeof(buf)));
+  EXPECT_STREQ("", buf);
+  // Patterns without the offset are not affected.
+  EXPECT_EQ("00:00",
+            Format("%H:%M", DateTime(WallTime(), TimeZone(Hours(120)))));
+  // The largest offsets that fit.
+  EXPECT_EQ("+9959",
+            Format("%z", DateTime(WallTime(), TimeZone(Minutes(5999)))));
+  EXPECT_EQ("-99:59",
+            Format("%:z", DateTime(WallTime(), TimeZone(Minutes(-5999)))));
+}
+
+TEST(DateTimeFormat, Malformed) {
+  DateTimeFormat format("%d.%m.%Q");
+  EXPECT_FALSE(format.ok());
+  EXPECT_EQ(0u, format.maxLength());
+  char buf[16] = "garbage";
+  EXPECT_EQ(0u, format.format(DateTime(), buf, sizeof(buf)));
+  EXPECT_STREQ("", buf);
+}
+
+TEST(DateTimeFormat, SmallBuffer) {
+  DateTimeFormat format("%A %d");
+  DateTime dt(2024, 7, 1, timezone::UTC);
+  char buf[10];
+  EXPECT_EQ(9u, format.format(dt, buf, 10));
+  EXPECT_STREQ("Monday 01", buf);
+  EXPECT_EQ(0u, format.format(dt, buf, 9));
+  EXPECT_STREQ("", buf);
+  EXPECT_EQ(0u, format.format(dt, buf, 0));
+}
+
+TEST(DateTimeFormat, MatchesStrftime) {
+  const char* patterns[] = {
+      "%Y %y %m %d %e %j %H %I %p %M %S %a %A %u %w %b %h %B %z",
+      "%F %T %R %D %%",
+  };
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<int64_t> micros(0, 4000000000000000LL);
+  std::uniform_int_distribution<int> offset(-14 * 4, 14 * 4);
+  for (int i = 0; i < 20000; ++i) {
+    TimeZone tz(Minutes(15 * offset(gen)));
+    DateTime dt(WallTime(Micros(micros(gen))), tz);
+    struct tm tm = dt.tmStruct();
+    tm.tm_yday = dt.dayOfYear() - 1;
+    tm.tm_isdst = 0;
+    tm.tm_gmtoff = tz.offset().inSeconds();
+    for (const char* pattern : patterns) {
+      char expected[256];
+      strftime(expected, sizeof(expected), pattern, &tm);
+      ASSERT_EQ(expected, Format(pattern, dt));
+    }
+  }
+}
+
+}  // namespace roo_time
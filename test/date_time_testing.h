@@ -0,0 +1,26 @@
+#pragma once
+
+/// Assertions on `DateTime`, shared by the tests.
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+// Checks that the date-times are equal, and that so are all of their cached
+// calendar fields (which e.g. DateTime::plus() and DateTimeConverter compute
+// incrementally, rather than from the instant).
+inline void ExpectSameFields(const DateTime& expected, const DateTime& actual) {
+  EXPECT_EQ(expected, actual);
+  EXPECT_EQ(expected.year(), actual.year());
+  EXPECT_EQ(expected.month(), actual.month());
+  EXPECT_EQ(expected.day(), actual.day());
+  EXPECT_EQ(expected.hour(), actual.hour());
+  EXPECT_EQ(expected.minute(), actual.minute());
+  EXPECT_EQ(expected.second(), actual.second());
+  EXPECT_EQ(expected.micros(), actual.micros());
+  EXPECT_EQ(expected.dayOfWeek(), actual.dayOfWeek());
+  EXPECT_EQ(expected.dayOfYear(), actual.dayOfYear());
+}
+
+}  // namespace roo_time
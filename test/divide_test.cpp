@@ -0,0 +1,125 @@
+#include "roo_time/internal/divide.h"
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kMin = INT64_MIN;
+constexpr int64_t kMax = INT64_MAX;
+
+static_assert(div_by_reciprocal<1000>(-1999) == -1, "");
+static_assert(div_by_reciprocal<3600000000ULL>(kMin) ==
+                  kMin / 3600000000LL,
+              "");
+static_assert(Duration::Max().inHoursRoundedUp() == 2562047789LL, "");
+
+template <uint64_t kDivisor>
+void ExpectExact(int64_t n) {
+  ASSERT_EQ(n / (int64_t)kDivisor, div_by_reciprocal<kDivisor>(n))
+      << n << " / " << kDivisor;
+}
+
+// Checks the values at and around multiples of the divisor, where the
+// quotient changes, and near the ends of the range.
+template <uint64_t kDivisor>
+void CheckEdges() {
+  const int64_t d = kDivisor;
+  for (int64_t k : {0LL, 1LL, 2LL, 7LL, 1000LL, 123456789LL}) {
+    for (int64_t delta = -2; delta <= 2; ++delta) {
+      ExpectExact<kDivisor>(k * d + delta);
+      ExpectExact<kDivisor>(-k * d + delta);
+    }
+  }
+  for (int64_t delta = 0; delta < 2 * d && delta < 100000; ++delta) {
+    ExpectExact<kDivisor>(kMax - delta);
+    ExpectExact<kDivisor>(kMin + delta);
+  }
+  const int64_t q_max = kMax / d;
+  for (int64_t k = q_max - 100; k <= q_max; ++k) {
+    for (int64_t delta = -1; delta <= 1; ++delta) {
+      ExpectExact<kDivisor>(k * d + delta);
+      ExpectExact<kDivisor>(-k * d - delta);
+    }
+  }
+}
+
+template <uint64_t kDivisor>
+void CheckRandom() {
+  std::mt19937_64 gen(kDivisor);
+  for (int i = 0; i < 1000000; ++i) {
+    // Vary the magnitude, to cover small and large quotients alike.
+    ExpectExact<kDivisor>((int64_t)gen() >> (gen() % 64));
+  }
+}
+
+}  // namespace
+
+TEST(Divide, MulHi) {
+  std::mt19937_64 gen(42);
+  for (uint64_t a : {0ULL, 1ULL, 0xFFFFFFFFULL, 0x100000000ULL, ~0ULL}) {
+    for (uint64_t b : {0ULL, 1ULL, 0xFFFFFFFFULL, 0x100000000ULL, ~0ULL}) {
+      EXPECT_EQ(mulhi64(a, b), mulhi64_32(a, b)) << a << " * " << b;
+    }
+  }
+  EXPECT_EQ(~0ULL - 1, mulhi64_32(~0ULL, ~0ULL));
+  for (int i = 0; i < 1000000; ++i) {
+    uint64_t a = gen();
+    uint64_t b = gen();
+    ASSERT_EQ(mulhi64(a, b), mulhi64_32(a, b)) << a << " * " << b;
+  }
+}
+
+TEST(Divide, Millis) {
+  CheckEdges<1000>();
+  CheckRandom<1000>();
+  // Exhaustive over a window around zero.
+  for (int64_t n = -10000000; n <= 10000000; ++n) ExpectExact<1000>(n);
+}
+
+TEST(Divide, Seconds) {
+  CheckEdges<1000000>();
+  CheckRandom<1000000>();
+}
+
+TEST(Divide, Minutes) {
+  CheckEdges<60000000>();
+  CheckRandom<60000000>();
+}
+
+TEST(Divide, Hours) {
+  CheckEdges<3600000000ULL>();
+  CheckRandom<3600000000ULL>();
+}
+
+// Checks the rounding variants of Duration against the definitions, on
+// whichever division method this build selected.
+TEST(Divide, DurationConversions) {
+  std::mt19937_64 gen(7);
+  for (int i = 0; i < 1000000; ++i) {
+    int64_t n = (int64_t)gen() >> (gen() % 64);
+    // Keep clear of the ends of the range, where rounding up overflows.
+    if (n > kMax / 2 || n < kMin / 2) continue;
+    Duration d = Micros(n);
+    int64_t q = n / 1000000;
+    int64_t r = n % 1000000;
+    ASSERT_EQ(q, d.inSeconds());
+    ASSERT_EQ(r == 0 ? q : (n > 0 ? q + 1 : q - 1), d.inSecondsRoundedUp());
+    int64_t ar = r < 0 ? -r : r;
+    ASSERT_EQ(ar * 2 < 1000000 ? q : (n > 0 ? q + 1 : q - 1),
+              d.inSecondsRoundedNearest());
+    ASSERT_EQ(n / 1000, d.inMillis());
+    ASSERT_EQ(n / 60000000, d.inMinutes());
+    ASSERT_EQ(n / 3600000000LL, d.inHours());
+    ASSERT_EQ(n / 1000, (Uptime::Start() + d).inMillis());
+    ASSERT_EQ(n / 3600000000LL, (Uptime::Start() + d).inHours());
+  }
+}
+
+}  // namespace internal
+}  // namespace roo_time
@@ -0,0 +1,160 @@
+#include "roo_time/duration_format.h"
+
+#include <string.h>
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+namespace {
+
+std::string Format(Duration d) {
+  char buf[kDurationBufferSize];
+  size_t len = FormatDuration(d, buf, sizeof(buf));
+  EXPECT_EQ(strlen(buf), len);
+  return std::string(buf, len);
+}
+
+// Returns the parsed duration in micros, or -12345 on failure.
+int64_t Parse(const char* str) {
+  Duration d = Micros(-12345);
+  if (!ParseDuration(str, &d)) {
+    EXPECT_EQ(-12345, d.inMicros()) << str;
+  }
+  return d.inMicros();
+}
+
+bool Fails(const char* str) {
+  Duration d;
+  return !ParseDuration(str, &d);
+}
+
+}  // namespace
+
+TEST(FormatDuration, Basic) {
+  EXPECT_EQ("0s", Format(Duration()));
+  EXPECT_EQ("1us", Format(Micros(1)));
+  EXPECT_EQ("999us", Format(Micros(999)));
+  EXPECT_EQ("1ms", Format(Millis(1)));
+  EXPECT_EQ("1.5ms", Format(Micros(1500)));
+  EXPECT_EQ("1.001ms", Format(Micros(1001)));
+  EXPECT_EQ("250ms", Format(Millis(250)));
+  EXPECT_EQ("1s", Format(Seconds(1)));
+  EXPECT_EQ("2.5s", Format(Millis(2500)));
+  EXPECT_EQ("1.000001s", Format(Micros(1000001)));
+  EXPECT_EQ("1m0s", Format(Minutes(1)));
+  EXPECT_EQ("1m30s", Format(Seconds(90)));
+  EXPECT_EQ("1h0m0s", Format(Hours(1)));
+  EXPECT_EQ("1h30m5.25s", Format(Hours(1) + Minutes(30) + Millis(5250)));
+  EXPECT_EQ("100h0m1s", Format(Hours(100) + Seconds(1)));
+  EXPECT_EQ("-1.5s", Format(Millis(-1500)));
+  EXPECT_EQ("-17us", Format(Micros(-17)));
+}
+
+TEST(FormatDuration, Extremes) {
+  EXPECT_EQ("2562047788h0m54.775807s", Format(Duration::Max()));
+  Duration min = Micros(-Duration::Max().inMicros() - 1);
+  EXPECT_EQ("-2562047788h0m54.775808s", Format(min));
+  std::string longest =
+      Format(Duration() - (Hours(1000000000) + Hours(1) - Micros(1)));
+  EXPECT_EQ("-1000000000h59m59.999999s", longest);
+  EXPECT_EQ(kDurationMaxLength, longest.size());
+}
+
+TEST(FormatDuration, SmallBuffer) {
+  char buf[6];
+  EXPECT_EQ(5u, FormatDuration(Millis(250), buf, 6));
+  EXPECT_STREQ("250ms", buf);
+  EXPECT_EQ(0u, FormatDuration(Millis(250), buf, 5));
+  EXPECT_STREQ("", buf);
+  EXPECT_EQ(0u, FormatDuration(Millis(250), buf, 0));
+}
+
+TEST(ParseDuration, Basic) {
+  EXPECT_EQ(0, Parse("0"));
+  EXPECT_EQ(0, Parse("-0"));
+  EXPECT_EQ(0, Parse("0s"));
+  EXPECT_EQ(250000, Parse("250ms"));
+  EXPECT_EQ(1500, Parse("1.5ms"));
+  EXPECT_EQ(17, Parse("17us"));
+  EXPECT_EQ(17, Parse("17\xC2\xB5s"));
+  EXPECT_EQ(17, Parse("17\xCE\xBCs"));
+  EXPECT_EQ(5400000000LL, Parse("1h30m"));
+  EXPECT_EQ(5405250000LL, Parse("1h30m5.25s"));
+  EXPECT_EQ(-5405250000LL, Parse("-1h30m5.25s"));
+  EXPECT_EQ(5405250000LL, Parse("+1h30m5.25s"));
+  EXPECT_EQ(5400000000LL, Parse("1.5h"));
+  EXPECT_EQ(500000, Parse(".5s"));
+  EXPECT_EQ(5000000, Parse("5.s"));
+  EXPECT_EQ(3000000, Parse("1s2s"));
+  EXPECT_EQ(1000001, Parse("1.000001s"));
+  EXPECT_EQ(333333, Parse("0.333333333333333333333333s"));
+  EXPECT_EQ(1800, Parse("0.0000005h"));
+}
+
+TEST(ParseDuration, SubMicrosecond) {
+  EXPECT_EQ(0, Parse("999ns"));
+  EXPECT_EQ(1, Parse("1500ns"));
+  EXPECT_EQ(1, Parse("1.9us"));
+  EXPECT_EQ(-1, Parse("-1500ns"));
+  EXPECT_EQ(1, Parse("1500.999ns"));
+}
+
+TEST(ParseDuration, Malformed) {
+  EXPECT_TRUE(Fails(""));
+  EXPECT_TRUE(Fails("-"));
+  EXPECT_TRUE(Fails("1"));
+  EXPECT_TRUE(Fails("10"));
+  EXPECT_TRUE(Fails("s"));
+  EXPECT_TRUE(Fails(".s"));
+  EXPECT_TRUE(Fails("1x"));
+  EXPECT_TRUE(Fails("1sec"));
+  EXPECT_TRUE(Fails("1s "));
+  EXPECT_TRUE(Fails(" 1s"));
+  EXPECT_TRUE(Fails("1s-1s"));
+  EXPECT_TRUE(Fails("1h30"));
+  EXPECT_TRUE(Fails("1..5s"));
+  EXPECT_TRUE(Fails("1.5.s"));
+}
+
+TEST(ParseDuration, NotNulTerminated) {
+  Duration d;
+  EXPECT_FALSE(ParseDuration("250ms", 3, &d));
+  EXPECT_TRUE(ParseDuration("1h30mXYZ", 5, &d));
+  EXPECT_EQ(5400000000LL, d.inMicros());
+}
+
+TEST(ParseDuration, Overflow) {
+  EXPECT_EQ(Duration::Max().inMicros(), Parse("9223372036854775807us"));
+  EXPECT_EQ(Duration::Max().inMicros(), Parse("2562047788h0m54.775807s"));
+  EXPECT_EQ(-Duration::Max().inMicros() - 1,
+            Parse("-9223372036854775808us"));
+  EXPECT_EQ(-Duration::Max().inMicros() - 1,
+            Parse("-2562047788h0m54.775808s"));
+  EXPECT_TRUE(Fails("9223372036854775808us"));
+  EXPECT_TRUE(Fails("2562047788h0m54.775808s"));
+  EXPECT_TRUE(Fails("-9223372036854775809us"));
+  EXPECT_TRUE(Fails("2562047789h"));
+  EXPECT_TRUE(Fails("9223372036854775807us1us"));
+  EXPECT_TRUE(Fails("18446744073709551616ns"));
+  EXPECT_TRUE(Fails("99999999999999999999999h"));
+}
+
+TEST(DurationFormat, RoundTrip) {
+  std::mt19937_64 gen(42);
+  for (int i = 0; i < 100000; ++i) {
+    // Vary the magnitude, to cover all the units.
+    int64_t micros = (int64_t)gen() >> (gen() % 64);
+    char buf[kDurationBufferSize];
+    ASSERT_GT(FormatDuration(Micros(micros), buf, sizeof(buf)), 0u) << micros;
+    Duration d;
+    ASSERT_TRUE(ParseDuration(buf, &d)) << buf;
+    ASSERT_EQ(micros, d.inMicros()) << buf;
+  }
+}
+
+}  // namespace roo_time
@@ -0,0 +1,166 @@
+#include "roo_time/format.h"
+
+#include <string.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+namespace {
+
+std::string Format(const DateTime& dt,
+                   Rfc3339Options options = Rfc3339Options()) {
+  char buf[kRfc3339BufferSize];
+  size_t len = FormatRfc3339(dt, buf, sizeof(buf), options);
+  EXPECT_EQ(strlen(buf), len);
+  return std::string(buf, len);
+}
+
+Rfc3339Options Fraction(uint8_t digits) {
+  Rfc3339Options options;
+  options.fraction_digits = digits;
+  return options;
+}
+
+}  // namespace
+
+TEST(FormatRfc3339, Basic) {
+  EXPECT_EQ("1970-01-01T00:00:00Z",
+            Format(DateTime(WallTime(), timezone::UTC)));
+  EXPECT_EQ("2024-07-01T14:05:09+02:00",
+            Format(DateTime(2024, 7, 1, 14, 5, 9, 0, TimeZone(Hours(2)))));
+  EXPECT_EQ("2024-12-31T23:59:59-05:00",
+            Format(DateTime(2024, 12, 31, 23, 59, 59, 0, TimeZone(Hours(-5)))));
+}
+
+TEST(FormatRfc3339, Offsets) {
+  EXPECT_EQ("2024-07-01T12:00:00+05:30",
+            Format(DateTime(2024, 7, 1, 12, 0, 0, 0, TimeZone(Minutes(330)))));
+  EXPECT_EQ("2024-07-01T12:00:00-09:30",
+            Format(DateTime(2024, 7, 1, 12, 0, 0, 0, TimeZone(Minutes(-570)))));
+  Rfc3339Options options;
+  options.zero_offset = Rfc3339Options::kNumeric;
+  EXPECT_EQ("2024-07-01T12:00:00+00:00",
+            Format(DateTime(2024, 7, 1, 12, 0, 0, 0, timezone::UTC), options));
+}
+
+TEST(FormatRfc3339, OutOfRangeOffsets) {
+  // Only two digits of hours fit.
+  char buf[kRfc3339BufferSize] = "x";
+  EXPECT_EQ(0u, FormatRfc3339(DateTime(WallTime(), TimeZone(Hours(120))), buf,
+                              sizeof(buf)));
+  EXPECT_STREQ("", buf);
+  buf[0] = 'x';
+  EXPECT_EQ(0u, FormatRfc3339(WallTime(), TimeZone(Minutes(-32768)), buf,
+                              sizeof(buf)));
+  EXPECT_STREQ("", buf);
+  WallTime times[2] = {WallTime(), WallTime(Hours(1))};
+  char out[2][kRfc3339BufferSize] = {"x", "x"};
+  EXPECT_EQ(0u, FormatRfc3339(times, 2, TimeZone(Hours(-100)), out[0],
+                              kRfc3339BufferSize));
+  EXPECT_STREQ("", out[0]);
+  EXPECT_STREQ("", out[1]);
+  // The largest offsets that fit.
+  EXPECT_EQ("1970-01-05T03:59:00+99:59",
+            Format(DateTime(WallTime(), TimeZone(Minutes(5999)))));
+  EXPECT_EQ("1969-12-27T20:01:00-99:59",
+            Format(DateTime(WallTime(), TimeZone(Minutes(-5999)))));
+}
+
+TEST(FormatRfc3339, Fraction) {
+  DateTime dt(2024, 7, 1, 12, 0, 0, 123456, timezone::UTC);
+  EXPECT_EQ("2024-07-01T12:00:00Z", Format(dt, Fraction(0)));
+  EXPECT_EQ("2024-07-01T12:00:00.1Z", Format(dt, Fraction(1)));
+  EXPECT_EQ("2024-07-01T12:00:00.123Z", Format(dt, Fraction(3)));
+  EXPECT_EQ("2024-07-01T12:00:00.123456Z", Format(dt, Fraction(6)));
+  // Truncates, rather than rounds.
+  EXPECT_EQ("2024-07-01T12:00:00.999Z",
+            Format(DateTime(2024, 7, 1, 12, 0, 0, 999999, timezone::UTC),
+                   Fraction(3)));
+  // Leading zeros are kept.
+  EXPECT_EQ("2024-07-01T12:00:00.000050Z",
+            Format(DateTime(2024, 7, 1, 12, 0, 0, 50, timezone::UTC),
+                   Fraction(6)));
+}
+
+TEST(FormatRfc3339, ExpandedYears) {
+  EXPECT_EQ("0001-01-01T00:00:00Z",
+            Format(DateTime(1, 1, 1, timezone::UTC)));
+  EXPECT_EQ("-0044-03-15T00:00:00Z",
+            Format(DateTime(-44, 3, 15, timezone::UTC)));
+  EXPECT_EQ("+12345-01-01T00:00:00Z",
+            Format(DateTime(12345, 1, 1, timezone::UTC)));
+  Rfc3339Options options = Fraction(6);
+  options.zero_offset = Rfc3339Options::kNumeric;
+  std::string longest =
+      Format(DateTime(-32768, 1, 1, 0, 0, 0, 0, timezone::UTC), options);
+  EXPECT_EQ("-32768-01-01T00:00:00.000000+00:00", longest);
+  EXPECT_EQ(kRfc3339MaxLength, longest.size());
+}
+
+TEST(FormatRfc3339, SmallBuffer) {
+  DateTime dt(2024, 7, 1, 12, 0, 0, 0, timezone::UTC);
+  char buf[21];
+  EXPECT_EQ(20u, FormatRfc3339(dt, buf, 21));
+  EXPECT_STREQ("2024-07-01T12:00:00Z", buf);
+  EXPECT_EQ(0u, FormatRfc3339(dt, buf, 20));
+  EXPECT_STREQ("", buf);
+  EXPECT_EQ(0u, FormatRfc3339(dt, buf, 0));
+}
+
+TEST(FormatRfc3339, WallTimeMatchesDateTime) {
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<int64_t> micros(-4000000000000000LL,
+                                                4000000000000000LL);
+  std::uniform_int_distribution<int> offset(-14 * 4, 14 * 4);
+  for (int i = 0; i < 100000; ++i) {
+    WallTime t(Micros(micros(gen)));
+    TimeZone tz(Minutes(15 * offset(gen)));
+    Rfc3339Options options = Fraction(i % 7);
+    char expected[kRfc3339BufferSize];
+    char actual[kRfc3339BufferSize];
+    FormatRfc3339(DateTime(t, tz), expected, sizeof(expected), options);
+    FormatRfc3339(t, tz, actual, sizeof(actual), options);
+    ASSERT_STREQ(expected, actual);
+  }
+}
+
+TEST(FormatRfc3339, Bulk) {
+  constexpr size_t kCount = 1000;
+  std::mt19937_64 gen(7);
+  std::uniform_int_distribution<int64_t> micros(0, 2000000000000000LL);
+  WallTime times[kCount];
+  for (size_t i = 0; i < kCount; ++i) times[i] = WallTime(Micros(micros(gen)));
+  TimeZone tz(Hours(-3));
+  Rfc3339Options options = Fraction(3);
+
+  std::vector<char> out(kCount * kRfc3339BufferSize);
+  EXPECT_EQ(kCount, FormatRfc3339(times, kCount, tz, out.data(),
+                                  kRfc3339BufferSize, options));
+  for (size_t i = 0; i < kCount; ++i) {
+    char expected[kRfc3339BufferSize];
+    FormatRfc3339(times[i], tz, expected, sizeof(expected), options);
+    ASSERT_STREQ(expected, &out[i * kRfc3339BufferSize]);
+  }
+
+  // Tightly packed: "YYYY-MM-DDTHH:MM:SS.sss-03:00" is 29 characters.
+  constexpr size_t kStride = 30;
+  std::vector<char> packed(kCount * kStride);
+  EXPECT_EQ(kCount,
+            FormatRfc3339(times, kCount, tz, packed.data(), kStride, options));
+  for (size_t i = 0; i < kCount; ++i) {
+    ASSERT_STREQ(&out[i * kRfc3339BufferSize], &packed[i * kStride]);
+  }
+
+  // Too small.
+  EXPECT_EQ(0u, FormatRfc3339(times, kCount, tz, packed.data(), kStride - 1,
+                              options));
+  EXPECT_STREQ("", &packed[0]);
+}
+
+}  // namespace roo_time
@@ -0,0 +1,51 @@
+#include "roo_time/lazy_date_time.h"
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+TEST(LazyDateTime, KnownValue) {
+  LazyDateTime d(WallTime(Micros(1590443851000001)), TimeZone(Hours(2)));
+  EXPECT_EQ(23, d.hour());
+  EXPECT_EQ(kMonday, d.dayOfWeek());
+  EXPECT_EQ(2020, d.year());
+  EXPECT_EQ(kMay, d.month());
+  EXPECT_EQ(25, d.day());
+  EXPECT_EQ(57, d.minute());
+  EXPECT_EQ(31, d.second());
+  EXPECT_EQ(1u, d.micros());
+  EXPECT_EQ(146, d.dayOfYear());
+  EXPECT_EQ(1590443851000001, d.wallTime().sinceEpoch().inMicros());
+  EXPECT_EQ(Hours(2), d.timeZone().offset());
+}
+
+// Each field must be correct regardless of which fields were read before.
+TEST(LazyDateTime, MatchesDateTimeInAnyAccessOrder) {
+  std::mt19937_64 gen(3);
+  // Years 1800 to 2300.
+  std::uniform_int_distribution<int64_t> dist(-5364662400000000LL,
+                                              10413792000000000LL);
+  TimeZone tz(Minutes(-330));
+  for (int i = 0; i < 5000; ++i) {
+    WallTime t(Micros(dist(gen)));
+    DateTime expected(t, tz);
+    LazyDateTime first_date(t, tz);
+    EXPECT_EQ(expected.year(), first_date.year());
+    EXPECT_EQ(expected.dayOfYear(), first_date.dayOfYear());
+    EXPECT_EQ(expected.dayOfWeek(), first_date.dayOfWeek());
+    EXPECT_EQ(expected.micros(), first_date.micros());
+    LazyDateTime first_time(t, tz);
+    EXPECT_EQ(expected.second(), first_time.second());
+    EXPECT_EQ(expected.minute(), first_time.minute());
+    EXPECT_EQ(expected.hour(), first_time.hour());
+    EXPECT_EQ(expected.dayOfWeek(), first_time.dayOfWeek());
+    EXPECT_EQ(expected.day(), first_time.day());
+    EXPECT_EQ(expected.month(), first_time.month());
+    EXPECT_EQ(expected, first_time.toDateTime());
+  }
+}
+
+}  // namespace roo_time
@@ -0,0 +1,112 @@
+#include "roo_time/internal/overflow.h"
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+static_assert(SaturatingAdd(Duration::Max(), Micros(1)) == Duration::Max(),
+              "");
+static_assert(SaturatingAdd(Uptime::Start() + Seconds(5), Duration::Max()) ==
+                  Uptime::Max(),
+              "");
+static_assert(SaturatingMul(Seconds(1), 3) == Seconds(3), "");
+
+TEST(Overflow, SaturatingInt64) {
+  EXPECT_EQ(5, internal::saturating_add(2, 3));
+  EXPECT_EQ(INT64_MAX, internal::saturating_add(INT64_MAX, 1));
+  EXPECT_EQ(INT64_MIN, internal::saturating_add(INT64_MIN, -1));
+  EXPECT_EQ(INT64_MAX - 1, internal::saturating_add(INT64_MAX, -1));
+  EXPECT_EQ(-1, internal::saturating_sub(2, 3));
+  EXPECT_EQ(INT64_MAX, internal::saturating_sub(0, INT64_MIN));
+  EXPECT_EQ(INT64_MIN, internal::saturating_sub(INT64_MIN, 1));
+  EXPECT_EQ(INT64_MIN, internal::saturating_sub(-2, INT64_MAX));
+  EXPECT_EQ(-6, internal::saturating_mul(2, -3));
+  EXPECT_EQ(INT64_MAX, internal::saturating_mul(INT64_MAX, 2));
+  EXPECT_EQ(INT64_MAX, internal::saturating_mul(INT64_MIN, -1));
+  EXPECT_EQ(INT64_MIN, internal::saturating_mul(INT64_MAX, -2));
+  EXPECT_EQ(INT64_MIN, internal::saturating_mul(-2, INT64_MAX));
+}
+
+TEST(Overflow, SaturatingDuration) {
+  EXPECT_EQ(Seconds(3), SaturatingAdd(Seconds(1), Seconds(2)));
+  EXPECT_EQ(Duration::Max(), SaturatingAdd(Duration::Max(), Duration::Max()));
+  EXPECT_EQ(Duration::Max(), SaturatingAdd(Hours(1), Duration::Max()));
+  EXPECT_EQ(Micros(INT64_MIN),
+            SaturatingSub(Micros(-2), Duration::Max()));
+  EXPECT_EQ(Duration::Max(), SaturatingSub(Micros(0), Micros(INT64_MIN)));
+  EXPECT_EQ(Duration::Max(), SaturatingMul(Hours(1), 1LL << 40));
+  EXPECT_EQ(Micros(INT64_MIN), SaturatingMul(Hours(-1), 1LL << 40));
+  EXPECT_EQ(Micros(INT64_MIN), SaturatingMul(Hours(1), -(1LL << 40)));
+  EXPECT_EQ(Hours(-4), SaturatingMul(Hours(2), -2));
+}
+
+TEST(Overflow, SaturatingUptime) {
+  Uptime now = Uptime::Start() + Hours(1000);
+  EXPECT_EQ(now + Seconds(5), SaturatingAdd(now, Seconds(5)));
+  EXPECT_EQ(Uptime::Max(), SaturatingAdd(now, Duration::Max()));
+  EXPECT_EQ(Uptime::Max(), SaturatingAdd(Uptime::Max(), Millis(1)));
+  EXPECT_EQ(now - Seconds(5), SaturatingSub(now, Seconds(5)));
+  EXPECT_EQ(Uptime::Max(), SaturatingSub(now, Micros(INT64_MIN)));
+  // Deadlines computed from 'infinite' timeouts never come before now.
+  EXPECT_TRUE(SaturatingAdd(Uptime::Now(), Duration::Max()) > Uptime::Now());
+}
+
+TEST(Overflow, SaturatingWallTime) {
+  WallTime t(Hours(1000));
+  EXPECT_EQ(t + Seconds(5), SaturatingAdd(t, Seconds(5)));
+  EXPECT_EQ(WallTime(Duration::Max()), SaturatingAdd(t, Duration::Max()));
+  EXPECT_EQ(t - Seconds(5), SaturatingSub(t, Seconds(5)));
+  EXPECT_EQ(WallTime(Micros(INT64_MIN)),
+            SaturatingSub(WallTime(Hours(-1)), Duration::Max()));
+}
+
+TEST(Overflow, CheckedDuration) {
+  Duration d = Seconds(7);
+  EXPECT_TRUE(CheckedAdd(Seconds(1), Seconds(2), &d));
+  EXPECT_EQ(Seconds(3), d);
+  EXPECT_FALSE(CheckedAdd(Duration::Max(), Micros(1), &d));
+  EXPECT_EQ(Seconds(3), d);
+  EXPECT_TRUE(CheckedSub(Seconds(1), Seconds(2), &d));
+  EXPECT_EQ(Seconds(-1), d);
+  EXPECT_FALSE(CheckedSub(Micros(-2), Duration::Max(), &d));
+  EXPECT_EQ(Seconds(-1), d);
+  EXPECT_TRUE(CheckedMul(Seconds(2), -3, &d));
+  EXPECT_EQ(Seconds(-6), d);
+  EXPECT_FALSE(CheckedMul(Hours(1), 1LL << 40, &d));
+  EXPECT_EQ(Seconds(-6), d);
+}
+
+TEST(Overflow, CheckedUptime) {
+  Uptime u;
+  EXPECT_TRUE(CheckedAdd(Uptime::Start(), Seconds(2), &u));
+  EXPECT_EQ(Uptime::Start() + Seconds(2), u);
+  EXPECT_FALSE(CheckedAdd(u, Duration::Max(), &u));
+  EXPECT_EQ(Uptime::Start() + Seconds(2), u);
+  EXPECT_TRUE(CheckedSub(u, Seconds(3), &u));
+  EXPECT_EQ(Uptime::Start() - Seconds(1), u);
+  EXPECT_FALSE(CheckedSub(u, Duration::Max(), &u));
+  EXPECT_EQ(Uptime::Start() - Seconds(1), u);
+}
+
+TEST(Overflow, CheckedWallTime) {
+  WallTime t;
+  EXPECT_TRUE(CheckedAdd(WallTime(), Seconds(2), &t));
+  EXPECT_EQ(WallTime(Seconds(2)), t);
+  EXPECT_FALSE(CheckedAdd(t, Duration::Max(), &t));
+  EXPECT_EQ(WallTime(Seconds(2)), t);
+  EXPECT_TRUE(CheckedSub(t, Seconds(3), &t));
+  EXPECT_EQ(WallTime(Seconds(-1)), t);
+  EXPECT_FALSE(CheckedSub(t, Duration::Max(), &t));
+  EXPECT_EQ(WallTime(Seconds(-1)), t);
+}
+
+TEST(Overflow, WrappingOperators) {
+  EXPECT_EQ(Micros(INT64_MIN), Duration::Max() + Micros(1));
+  EXPECT_EQ(Duration::Max(), Micros(INT64_MIN) - Micros(1));
+  Uptime u = Uptime::Max();
+  u += Micros(1);
+  EXPECT_EQ(INT64_MIN, u.inMicros());
+}
+
+}  // namespace roo_time
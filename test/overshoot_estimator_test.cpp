@@ -0,0 +1,52 @@
+#include "roo_time/internal/overshoot_estimator.h"
+
+#include "gtest/gtest.h"
+
+namespace roo_time {
+namespace internal {
+
+TEST(OvershootEstimator, StartsAtZero) {
+  OvershootEstimator estimator;
+  EXPECT_EQ(0, estimator.mean());
+  EXPECT_EQ(0, estimator.lead());
+}
+
+TEST(OvershootEstimator, ConvergesToConstantOvershoot) {
+  OvershootEstimator estimator;
+  for (int i = 0; i < 100; ++i) estimator.update(60);
+  // Within the fixed-point resolution.
+  EXPECT_NEAR(60, estimator.mean(), 1);
+  EXPECT_NEAR(60, estimator.lead(), 4);
+}
+
+TEST(OvershootEstimator, LeadCoversJitter) {
+  OvershootEstimator estimator;
+  for (int i = 0; i < 100; ++i) estimator.update(i % 2 == 0 ? 40 : 80);
+  EXPECT_NEAR(60, estimator.mean(), 10);
+  // Mean plus four deviations, i.e. ~60 + 4 * 20.
+  EXPECT_GT(estimator.lead(), 80);
+  EXPECT_LT(estimator.lead(), 160);
+}
+
+TEST(OvershootEstimator, AdaptsQuickly) {
+  OvershootEstimator estimator;
+  for (int i = 0; i < 100; ++i) estimator.update(1000);
+  for (int i = 0; i < 30; ++i) estimator.update(50);
+  EXPECT_LT(estimator.mean(), 100);
+  estimator.update(5000);
+  // A single late wake-up raises the lead for the next few delays.
+  EXPECT_GT(estimator.lead(), 1000);
+}
+
+TEST(OvershootEstimator, ClampsSamples) {
+  OvershootEstimator estimator;
+  estimator.update(-100);
+  EXPECT_EQ(0, estimator.lead());
+  estimator.update(INT64_MAX);
+  EXPECT_EQ(OvershootEstimator::kMaxSampleMicros / 8, estimator.mean());
+  for (int i = 0; i < 100; ++i) estimator.update(INT64_MAX);
+  EXPECT_NEAR(OvershootEstimator::kMaxSampleMicros, estimator.mean(), 8);
+}
+
+}  // namespace internal
+}  // namespace roo_time
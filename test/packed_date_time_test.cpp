@@ -0,0 +1,85 @@
+#include "roo_time/packed_date_time.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+TEST(PackedDateTime, Size) { EXPECT_EQ(8u, sizeof(PackedDateTime)); }
+
+TEST(PackedDateTime, DefaultIsEpoch) {
+  PackedDateTime p;
+  EXPECT_EQ(1970, p.year());
+  EXPECT_EQ(kJanuary, p.month());
+  EXPECT_EQ(1, p.day());
+  EXPECT_EQ(WallTime(), p.toWallTime());
+}
+
+TEST(PackedDateTime, Constexpr) {
+  constexpr PackedDateTime p(2024, 2, 29, 23, 59, 58, 999999);
+  static_assert(p.year() == 2024, "");
+  static_assert(p.month() == kFebruary, "");
+  static_assert(p.day() == 29, "");
+  static_assert(p.hour() == 23, "");
+  static_assert(p.minute() == 59, "");
+  static_assert(p.second() == 58, "");
+  static_assert(p.micros() == 999999, "");
+  static_assert(PackedDateTime::FromWord(p.word()) == p, "");
+  static_assert(p < PackedDateTime(2024, 3, 1, 0, 0, 0, 0), "");
+}
+
+TEST(PackedDateTime, NegativeYear) {
+  PackedDateTime p(-44, 3, 15, 12, 0, 0, 0);
+  EXPECT_EQ(-44, p.year());
+  EXPECT_LT(p, PackedDateTime(0, 1, 1, 0, 0, 0, 0));
+}
+
+TEST(PackedDateTime, RoundTrip) {
+  TimeZone tz(Minutes(-210));
+  DateTime dt(2020, 05, 25, 23, 57, 31, 1, tz);
+  PackedDateTime p(dt);
+  EXPECT_EQ(2020, p.year());
+  EXPECT_EQ(kMay, p.month());
+  EXPECT_EQ(25, p.day());
+  EXPECT_EQ(23, p.hour());
+  EXPECT_EQ(57, p.minute());
+  EXPECT_EQ(31, p.second());
+  EXPECT_EQ(1u, p.micros());
+  EXPECT_EQ(dt.wallTime(), p.toWallTime(tz));
+  DateTime back = p.toDateTime(tz);
+  EXPECT_EQ(dt, back);
+  EXPECT_EQ(dt.dayOfWeek(), back.dayOfWeek());
+  EXPECT_EQ(dt.dayOfYear(), back.dayOfYear());
+  EXPECT_EQ(p, PackedDateTime::FromWallTime(dt.wallTime(), tz));
+}
+
+TEST(PackedDateTime, OrderingMatchesWallTime) {
+  std::mt19937_64 gen(7);
+  // Years 1900 to 2200.
+  std::uniform_int_distribution<int64_t> dist(-2208988800000000LL,
+                                              7258118400000000LL);
+  TimeZone tz(Hours(9));
+  std::vector<WallTime> times;
+  std::vector<PackedDateTime> packed;
+  for (int i = 0; i < 2000; ++i) {
+    WallTime t(Micros(dist(gen)));
+    times.push_back(t);
+    packed.push_back(PackedDateTime::FromWallTime(t, tz));
+    EXPECT_EQ(t, packed.back().toWallTime(tz));
+  }
+  for (size_t i = 1; i < times.size(); ++i) {
+    EXPECT_EQ(times[i - 1] < times[i], packed[i - 1] < packed[i]);
+    EXPECT_EQ(times[i - 1] == times[i], packed[i - 1] == packed[i]);
+  }
+  std::sort(times.begin(), times.end());
+  std::sort(packed.begin(), packed.end());
+  for (size_t i = 0; i < times.size(); ++i) {
+    EXPECT_EQ(times[i], packed[i].toWallTime(tz));
+  }
+}
+
+}  // namespace roo_time
@@ -0,0 +1,257 @@
+#include "roo_time/parse.h"
+
+#include <string.h>
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+#include "roo_time/format.h"
+
+namespace roo_time {
+
+namespace {
+
+WallTime Utc(int16_t year, uint8_t month, uint8_t day, uint8_t hour,
+             uint8_t minute, uint8_t second, uint32_t micros) {
+  return WallTimeFromCivil(year, month, day, hour, minute, second, micros,
+                           timezone::UTC);
+}
+
+bool Parse(const std::string& s, WallTime* result, TimeZone* tz = nullptr) {
+  return ParseRfc3339(s.data(), s.size(), result, tz);
+}
+
+// Straightforward reference parser, following the RFC 3339 grammar character
+// by character.
+bool ReferenceParse(const std::string& s, WallTime* result) {
+  size_t pos = 0;
+  auto number = [&](int digits, int* value) {
+    *value = 0;
+    for (int i = 0; i < digits; ++i, ++pos) {
+      if (pos >= s.size() || s[pos] < '0' || s[pos] > '9') return false;
+      *value = *value * 10 + (s[pos] - '0');
+    }
+    return true;
+  };
+  auto literal = [&](const char* options) {
+    if (pos >= s.size() || strchr(options, s[pos]) == nullptr ||
+        s[pos] == '\0') {
+      return false;
+    }
+    ++pos;
+    return true;
+  };
+  int year, month, day, hour, minute, second;
+  if (!number(4, &year) || !literal("-") || !number(2, &month) ||
+      !literal("-") || !number(2, &day) || !literal("Tt ") ||
+      !number(2, &hour) || !literal(":") || !number(2, &minute) ||
+      !literal(":") || !number(2, &second)) {
+    return false;
+  }
+  if (month < 1 || month > 12 || day < 1 ||
+      day > DateTime(year, month, 1, timezone::UTC).plusMonths(1).plusDays(-1)
+                .day() ||
+      hour > 23 || minute > 59 || second > 59) {
+    return false;
+  }
+  int micros = 0;
+  if (pos < s.size() && s[pos] == '.') {
+    ++pos;
+    int digits = 0;
+    while (pos < s.size() && s[pos] >= '0' && s[pos] <= '9') {
+      if (digits < 6) micros = micros * 10 + (s[pos] - '0');
+      ++digits;
+      ++pos;
+    }
+    if (digits == 0) return false;
+    for (; digits < 6; ++digits) micros *= 10;
+  }
+  int offset = 0;
+  if (literal("Zz")) {
+  } else if (pos < s.size() && (s[pos] == '+' || s[pos] == '-')) {
+    bool negative = (s[pos++] == '-');
+    int oh, om;
+    if (!number(2, &oh) || !literal(":") || !number(2, &om) || oh > 23 ||
+        om > 59) {
+      return false;
+    }
+    offset = (negative ? -1 : 1) * (oh * 60 + om);
+  } else {
+    return false;
+  }
+  if (pos != s.size()) return false;
+  *result = Utc(year, month, day, hour, minute, second, micros) -
+            Minutes(offset);
+  return true;
+}
+
+}  // namespace
+
+TEST(ParseRfc3339, Basic) {
+  WallTime t;
+  TimeZone tz(Hours(5));
+  ASSERT_TRUE(Parse("1970-01-01T00:00:00Z", &t, &tz));
+  EXPECT_EQ(WallTime(), t);
+  EXPECT_EQ(Micros(0), tz.offset());
+  ASSERT_TRUE(Parse("2024-07-01T14:05:09+02:00", &t, &tz));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 5, 9, 0), t);
+  EXPECT_EQ(Hours(2), tz.offset());
+  ASSERT_TRUE(Parse("2024-12-31T23:59:59-05:30", &t, &tz));
+  EXPECT_EQ(Utc(2025, 1, 1, 5, 29, 59, 0), t);
+  EXPECT_EQ(Minutes(-330), tz.offset());
+}
+
+TEST(ParseRfc3339, Variants) {
+  WallTime t;
+  ASSERT_TRUE(Parse("2024-07-01t12:00:00z", &t));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 0, 0, 0), t);
+  ASSERT_TRUE(Parse("2024-07-01 12:00:00Z", &t));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 0, 0, 0), t);
+  ASSERT_TRUE(Parse("2024-07-01T12:00:00-00:00", &t));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 0, 0, 0), t);
+  ASSERT_TRUE(ParseRfc3339("2024-07-01T12:00:00Z", &t));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 0, 0, 0), t);
+}
+
+TEST(ParseRfc3339, Fraction) {
+  WallTime t;
+  ASSERT_TRUE(Parse("2024-07-01T12:00:00.1Z", &t));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 0, 0, 100000), t);
+  ASSERT_TRUE(Parse("2024-07-01T12:00:00.000050Z", &t));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 0, 0, 50), t);
+  // Digits beyond microseconds are truncated.
+  ASSERT_TRUE(Parse("2024-07-01T12:00:00.123456789Z", &t));
+  EXPECT_EQ(Utc(2024, 7, 1, 12, 0, 0, 123456), t);
+}
+
+TEST(ParseRfc3339, DateTime) {
+  std::string s = "2024-02-29T23:30:00.5+05:30";
+  DateTime dt;
+  ASSERT_TRUE(ParseRfc3339(s.data(), s.size(), &dt));
+  EXPECT_EQ(2024, dt.year());
+  EXPECT_EQ(kFebruary, dt.month());
+  EXPECT_EQ(29, dt.day());
+  EXPECT_EQ(23, dt.hour());
+  EXPECT_EQ(30, dt.minute());
+  EXPECT_EQ(500000u, dt.micros());
+  EXPECT_EQ(Minutes(330), dt.timeZone().offset());
+}
+
+TEST(ParseRfc3339, Invalid) {
+  const char* invalid[] = {
+      "",
+      "2024-07-01",
+      "2024-07-01T12:00:00",
+      "2024-07-01T12:00Z",
+      "2024-07-01X12:00:00Z",
+      "2024/07/01T12:00:00Z",
+      "2024-07-01T12-00-00Z",
+      "2024-13-01T12:00:00Z",
+      "2024-00-01T12:00:00Z",
+      "2024-07-00T12:00:00Z",
+      "2024-06-31T12:00:00Z",
+      "2023-02-29T12:00:00Z",
+      "2024-07-01T24:00:00Z",
+      "2024-07-01T12:60:00Z",
+      "2024-07-01T12:00:60Z",
+      "2024-07-01T12:00:00.Z",
+      "2024-07-01T12:00:00.123",
+      "2024-07-01T12:00:00+02",
+      "2024-07-01T12:00:00+0200",
+      "2024-07-01T12:00:00+24:00",
+      "2024-07-01T12:00:00+02:60",
+      "2024-07-01T12:00:00ZZ",
+      "2024-07-01T12:00:00Z ",
+      " 2024-07-01T12:00:00Z",
+      "2O24-07-01T12:00:00Z",
+      "2024-07-01T12:00:0OZ",
+      "+2024-07-01T12:00:00Z",
+  };
+  for (const char* s : invalid) {
+    WallTime t(Seconds(123));
+    TimeZone tz(Hours(3));
+    EXPECT_FALSE(Parse(s, &t, &tz)) << s;
+    EXPECT_EQ(WallTime(Seconds(123)), t) << s;
+    EXPECT_EQ(Hours(3), tz.offset()) << s;
+  }
+}
+
+TEST(ParseRfc3339, DoesNotReadPastLength) {
+  // A valid timestamp, truncated by the length argument.
+  const char* s = "2024-07-01T12:00:00Z";
+  WallTime t;
+  for (size_t len = 0; len < strlen(s); ++len) {
+    EXPECT_FALSE(ParseRfc3339(s, len, &t)) << len;
+  }
+  // Fraction at the very end of the input.
+  EXPECT_FALSE(ParseRfc3339("2024-07-01T12:00:00.5Z", 21, &t));
+}
+
+TEST(ParseRfc3339, RoundTrip) {
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<int64_t> micros(
+      Utc(0, 1, 1, 12, 0, 0, 0).sinceEpoch().inMicros(),
+      Utc(9999, 12, 31, 12, 0, 0, 0).sinceEpoch().inMicros());
+  std::uniform_int_distribution<int> offset(-23 * 60 - 59, 23 * 60 + 59);
+  for (int i = 0; i < 100000; ++i) {
+    WallTime t(Micros(micros(gen)));
+    TimeZone tz(Minutes(offset(gen)));
+    Rfc3339Options options;
+    options.fraction_digits = 6;
+    options.zero_offset = (i % 2 == 0) ? Rfc3339Options::kZulu
+                                       : Rfc3339Options::kNumeric;
+    char buf[kRfc3339BufferSize];
+    size_t len = FormatRfc3339(t, tz, buf, sizeof(buf), options);
+    WallTime parsed;
+    TimeZone parsed_tz;
+    ASSERT_TRUE(ParseRfc3339(buf, len, &parsed, &parsed_tz)) << buf;
+    ASSERT_EQ(t, parsed) << buf;
+    ASSERT_EQ(tz.offset(), parsed_tz.offset()) << buf;
+  }
+}
+
+TEST(ParseRfc3339, FuzzAgainstReference) {
+  // Random single- and multi-character mutations of valid timestamps must be
+  // accepted or rejected exactly as by the reference parser.
+  const std::string seeds[] = {
+      "2024-07-01T14:05:09Z",
+      "2024-02-29T23:59:59.999999+14:00",
+      "1999-12-31t00:00:00.1-09:30",
+      "0000-01-01 00:00:00z",
+  };
+  const char alphabet[] = "0123456789-:.+TtZz /\x7f\xff";
+  std::mt19937 gen(7);
+  for (int i = 0; i < 300000; ++i) {
+    std::string s = seeds[i % 4];
+    int mutations = 1 + gen() % 3;
+    for (int m = 0; m < mutations; ++m) {
+      switch (gen() % 4) {
+        case 0:
+        case 1: {
+          s[gen() % s.size()] = alphabet[gen() % (sizeof(alphabet) - 1)];
+          break;
+        }
+        case 2: {
+          s.insert(s.begin() + gen() % (s.size() + 1),
+                   alphabet[gen() % (sizeof(alphabet) - 1)]);
+          break;
+        }
+        default: {
+          if (s.size() > 1) s.erase(s.begin() + gen() % s.size());
+          break;
+        }
+      }
+    }
+    WallTime expected;
+    WallTime actual;
+    bool expected_ok = ReferenceParse(s, &expected);
+    ASSERT_EQ(expected_ok, Parse(s, &actual)) << s;
+    if (expected_ok) {
+      ASSERT_EQ(expected, actual) << s;
+    }
+  }
+}
+
+}  // namespace roo_time
@@ -0,0 +1,243 @@
+#include "roo_time/posix_tz.h"
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+#include "roo_time/tzdb/zones.h"
+
+namespace roo_time {
+
+namespace {
+
+Duration OffsetAt(const TimeZoneRules& zone, WallTime t) {
+  return zone.timeZoneAt(t).offset();
+}
+
+// Checks that `posix` and `reference` agree at pseudo-random instants in
+// [from_year, 2037], and around all DST transitions in that range.
+void ExpectSameAsTzdb(const PosixTimeZone& posix,
+                      const TzdbTimeZone& reference, int16_t from_year) {
+  for (int16_t year = from_year; year <= 2037; ++year) {
+    WallTime start;
+    WallTime end;
+    ASSERT_TRUE(posix.transitions(year, &start, &end));
+    for (WallTime t : {start, end}) {
+      EXPECT_EQ(OffsetAt(reference, t - Micros(1)),
+                OffsetAt(posix, t - Micros(1)))
+          << year;
+      EXPECT_EQ(OffsetAt(reference, t), OffsetAt(posix, t)) << year;
+    }
+  }
+  int64_t begin = WallTimeFromCivil(from_year, 1, 1, timezone::UTC)
+                      .sinceEpoch()
+                      .inSeconds();
+  int64_t range =
+      WallTimeFromCivil(2038, 1, 1, timezone::UTC).sinceEpoch().inSeconds() -
+      begin;
+  uint32_t state = 12345;
+  for (int i = 0; i < 100000; ++i) {
+    state = state * 1664525 + 1013904223;
+    WallTime t(Seconds(begin + (int64_t)state % range));
+    ASSERT_EQ(OffsetAt(reference, t), OffsetAt(posix, t))
+        << t.sinceEpoch().inSeconds();
+  }
+}
+
+}  // namespace
+
+TEST(PosixTimeZone, DefaultIsUtc) {
+  PosixTimeZone zone;
+  EXPECT_STREQ("UTC", zone.standardName());
+  EXPECT_FALSE(zone.hasDaylightTime());
+  EXPECT_EQ(Micros(0), OffsetAt(zone, WallTime()));
+}
+
+TEST(PosixTimeZone, FixedOffset) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("JST-9"));
+  EXPECT_STREQ("JST", zone.standardName());
+  EXPECT_STREQ("", zone.daylightName());
+  EXPECT_FALSE(zone.hasDaylightTime());
+  EXPECT_EQ(Hours(9), OffsetAt(zone, WallTime()));
+  EXPECT_EQ(Hours(9), OffsetAt(zone, WallTimeFromCivil(2024, 7, 1,
+                                                       timezone::UTC)));
+
+  ASSERT_TRUE(zone.parse("<+0330>-3:30"));
+  EXPECT_STREQ("+0330", zone.standardName());
+  EXPECT_EQ(Minutes(210), OffsetAt(zone, WallTime()));
+
+  ASSERT_TRUE(zone.parse("<-03>3"));
+  EXPECT_EQ(Hours(-3), OffsetAt(zone, WallTime()));
+}
+
+TEST(PosixTimeZone, Names) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  EXPECT_STREQ("CET", zone.standardName());
+  EXPECT_STREQ("CEST", zone.daylightName());
+  EXPECT_TRUE(zone.hasDaylightTime());
+  EXPECT_EQ(Hours(1), zone.standardTime().offset());
+  EXPECT_EQ(Hours(2), zone.daylightTime().offset());
+}
+
+TEST(PosixTimeZone, Transitions) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  WallTime start;
+  WallTime end;
+  ASSERT_TRUE(zone.transitions(2024, &start, &end));
+  EXPECT_EQ(WallTimeFromCivil(2024, 3, 31, 1, 0, 0, 0, timezone::UTC), start);
+  EXPECT_EQ(WallTimeFromCivil(2024, 10, 27, 1, 0, 0, 0, timezone::UTC), end);
+  EXPECT_EQ(Hours(1), OffsetAt(zone, start - Micros(1)));
+  EXPECT_EQ(Hours(2), OffsetAt(zone, start));
+  EXPECT_EQ(Hours(2), OffsetAt(zone, end - Micros(1)));
+  EXPECT_EQ(Hours(1), OffsetAt(zone, end));
+
+  ASSERT_TRUE(zone.parse("JST-9"));
+  EXPECT_FALSE(zone.transitions(2024, &start, &end));
+}
+
+TEST(PosixTimeZone, TransitionBetween) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  WallTime start = WallTimeFromCivil(2024, 3, 31, 1, 0, 0, 0, timezone::UTC);
+  WallTime end = WallTimeFromCivil(2024, 10, 27, 1, 0, 0, 0, timezone::UTC);
+  WallTime t;
+  ASSERT_TRUE(zone.transitionBetween(start - Hours(24), start + Hours(24), &t));
+  EXPECT_EQ(start, t);
+  ASSERT_TRUE(zone.transitionBetween(start - Micros(1), start, &t));
+  EXPECT_EQ(start, t);
+  ASSERT_TRUE(zone.transitionBetween(start, end, &t));
+  EXPECT_EQ(end, t);
+  EXPECT_FALSE(zone.transitionBetween(start, end - Micros(1), &t));
+  // Across the end of the year.
+  ASSERT_TRUE(zone.transitionBetween(end, start + Hours(24 * 365), &t));
+  EXPECT_EQ(WallTimeFromCivil(2025, 3, 30, 1, 0, 0, 0, timezone::UTC), t);
+
+  // Southern hemisphere.
+  ASSERT_TRUE(zone.parse("AEST-10AEDT,M10.1.0,M4.1.0/3"));
+  ASSERT_TRUE(zone.transitionBetween(
+      WallTimeFromCivil(2024, 1, 1, timezone::UTC),
+      WallTimeFromCivil(2025, 1, 1, timezone::UTC), &t));
+  EXPECT_EQ(WallTimeFromCivil(2024, 4, 6, 16, 0, 0, 0, timezone::UTC), t);
+
+  // No transitions.
+  WallTime from = WallTimeFromCivil(2024, 1, 1, timezone::UTC);
+  WallTime to = WallTimeFromCivil(2027, 1, 1, timezone::UTC);
+  ASSERT_TRUE(zone.parse("JST-9"));
+  EXPECT_FALSE(zone.transitionBetween(from, to, &t));
+  ASSERT_TRUE(zone.parse("EST5EDT,0/0,J365/25"));
+  EXPECT_FALSE(zone.transitionBetween(from, to, &t));
+}
+
+TEST(PosixTimeZone, JulianRules) {
+  PosixTimeZone zone;
+  // Jn never counts February 29, so J60 is always March 1.
+  ASSERT_TRUE(zone.parse("AAA0BBB,J60/0,J305/0"));
+  WallTime start;
+  WallTime end;
+  ASSERT_TRUE(zone.transitions(2024, &start, &end));
+  EXPECT_EQ(WallTimeFromCivil(2024, 3, 1, timezone::UTC), start);
+  EXPECT_EQ(WallTimeFromCivil(2024, 11, 1, 0, 0, 0, 0, TimeZone(Hours(1))),
+            end);
+  ASSERT_TRUE(zone.transitions(2023, &start, &end));
+  EXPECT_EQ(WallTimeFromCivil(2023, 3, 1, timezone::UTC), start);
+
+  // Zero-based n counts February 29.
+  ASSERT_TRUE(zone.parse("AAA0BBB,59/0,304/0"));
+  ASSERT_TRUE(zone.transitions(2024, &start, &end));
+  EXPECT_EQ(WallTimeFromCivil(2024, 2, 29, timezone::UTC), start);
+  ASSERT_TRUE(zone.transitions(2023, &start, &end));
+  EXPECT_EQ(WallTimeFromCivil(2023, 3, 1, timezone::UTC), start);
+}
+
+TEST(PosixTimeZone, DefaultRules) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("EST5EDT"));
+  EXPECT_EQ(Hours(-4), zone.daylightTime().offset());
+  WallTime start;
+  WallTime end;
+  ASSERT_TRUE(zone.transitions(2024, &start, &end));
+  EXPECT_EQ(WallTimeFromCivil(2024, 3, 10, 7, 0, 0, 0, timezone::UTC), start);
+  EXPECT_EQ(WallTimeFromCivil(2024, 11, 3, 6, 0, 0, 0, timezone::UTC), end);
+}
+
+TEST(PosixTimeZone, ExplicitDaylightOffset) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("<+1030>-10:30<+11>-11,M10.1.0,M4.1.0"));
+  EXPECT_EQ(Minutes(630), zone.standardTime().offset());
+  EXPECT_EQ(Hours(11), zone.daylightTime().offset());
+}
+
+TEST(PosixTimeZone, PermanentDaylightTime) {
+  PosixTimeZone zone;
+  // RFC 8536 idiom for DST all year round.
+  ASSERT_TRUE(zone.parse("EST5EDT,0/0,J365/25"));
+  for (int month = 1; month <= 12; ++month) {
+    EXPECT_EQ(Hours(-4),
+              OffsetAt(zone, WallTimeFromCivil(2024, month, 1, timezone::UTC)))
+        << month;
+  }
+  EXPECT_EQ(Hours(-4),
+            OffsetAt(zone, WallTimeFromCivil(2024, 12, 31, 23, 59, 59, 0,
+                                             TimeZone(Hours(-4)))));
+}
+
+TEST(PosixTimeZone, NegativeDaylightSaving) {
+  PosixTimeZone zone;
+  // Europe/Dublin: standard time in summer, "daylight" time in winter.
+  ASSERT_TRUE(zone.parse("IST-1GMT0,M10.5.0,M3.5.0/1"));
+  EXPECT_EQ(Micros(0),
+            OffsetAt(zone, WallTimeFromCivil(2024, 1, 15, timezone::UTC)));
+  EXPECT_EQ(Hours(1),
+            OffsetAt(zone, WallTimeFromCivil(2024, 7, 15, timezone::UTC)));
+  EXPECT_EQ(Micros(0),
+            OffsetAt(zone, WallTimeFromCivil(2024, 12, 15, timezone::UTC)));
+}
+
+TEST(PosixTimeZone, Malformed) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  EXPECT_FALSE(zone.parse(""));
+  EXPECT_FALSE(zone.parse("CET"));
+  EXPECT_FALSE(zone.parse("CE-1"));
+  EXPECT_FALSE(zone.parse("CET-25"));
+  EXPECT_FALSE(zone.parse("CET-1:60"));
+  EXPECT_FALSE(zone.parse("<+03-3"));
+  EXPECT_FALSE(zone.parse("VERYLONGNAME-1"));
+  EXPECT_FALSE(zone.parse("CET-1CEST,M3.5.0"));
+  EXPECT_FALSE(zone.parse("CET-1CEST,M13.5.0,M10.5.0"));
+  EXPECT_FALSE(zone.parse("CET-1CEST,M3.6.0,M10.5.0"));
+  EXPECT_FALSE(zone.parse("CET-1CEST,M3.5.7,M10.5.0"));
+  EXPECT_FALSE(zone.parse("CET-1CEST,J0,J100"));
+  EXPECT_FALSE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/168"));
+  EXPECT_FALSE(zone.parse("CET-1CEST,M3.5.0,M10.5.0x"));
+  EXPECT_FALSE(zone.parse(":Europe/Warsaw"));
+  // Failed parses leave the zone unchanged.
+  EXPECT_STREQ("CEST", zone.daylightName());
+  EXPECT_EQ(Hours(2),
+            OffsetAt(zone, WallTimeFromCivil(2024, 7, 1, timezone::UTC)));
+}
+
+TEST(PosixTimeZone, MatchesTzdb) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  ExpectSameAsTzdb(zone, tzdb::Europe_Warsaw, 1996);
+  ASSERT_TRUE(zone.parse("GMT0BST,M3.5.0/1,M10.5.0"));
+  ExpectSameAsTzdb(zone, tzdb::Europe_London, 1996);
+  ASSERT_TRUE(zone.parse("EST5EDT,M3.2.0,M11.1.0"));
+  ExpectSameAsTzdb(zone, tzdb::America_New_York, 2007);
+  ASSERT_TRUE(zone.parse("PST8PDT,M3.2.0,M11.1.0"));
+  ExpectSameAsTzdb(zone, tzdb::America_Los_Angeles, 2007);
+  ASSERT_TRUE(zone.parse("AEST-10AEDT,M10.1.0,M4.1.0/3"));
+  ExpectSameAsTzdb(zone, tzdb::Australia_Sydney, 2008);
+}
+
+TEST(PosixTimeZone, DateTime) {
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  DateTime dt(WallTimeFromCivil(2024, 7, 1, 12, 0, 0, 0, timezone::UTC), zone);
+  EXPECT_EQ(14, dt.hour());
+  EXPECT_EQ(Hours(2), dt.timeZone().offset());
+}
+
+}  // namespace roo_time
@@ -0,0 +1,210 @@
+#include "roo_time/resolve.h"
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+#include "roo_time/posix_tz.h"
+#include "roo_time/tzdb/zones.h"
+
+namespace roo_time {
+
+namespace {
+
+LocalTimeResolution Resolve(int16_t year, uint8_t month, uint8_t day,
+                            uint8_t hour, uint8_t minute,
+                            const TimeZoneRules& zone) {
+  return ResolveLocalTime(year, month, day, hour, minute, 0, 0, zone);
+}
+
+WallTime Utc(int16_t year, uint8_t month, uint8_t day, uint8_t hour,
+             uint8_t minute) {
+  return WallTimeFromCivil(year, month, day, hour, minute, 0, 0,
+                           timezone::UTC);
+}
+
+bool HasLocalTime(WallTime t, const TimeZoneRules& zone, int16_t year,
+                  uint8_t month, uint8_t day, uint8_t hour, uint8_t minute) {
+  DateTime dt(t, zone);
+  return dt.year() == year && dt.month() == month && dt.day() == day &&
+         dt.hour() == hour && dt.minute() == minute && dt.second() == 0 &&
+         dt.micros() == 0;
+}
+
+// Resolves every 15 minutes of local time in the specified years, and checks
+// the results against the forward conversion.
+void ExpectConsistent(const TimeZoneRules& zone, int16_t from_year,
+                      int16_t to_year) {
+  int skipped = 0;
+  int ambiguous = 0;
+  for (DateTime d(from_year, 1, 1, timezone::UTC); d.year() <= to_year;
+       d = d.plus(Minutes(15))) {
+    LocalTimeResolution r =
+        Resolve(d.year(), d.month(), d.day(), d.hour(), d.minute(), zone);
+    switch (r.kind) {
+      case LocalTimeResolution::kUnique: {
+        ASSERT_EQ(r.earliest, r.latest);
+        ASSERT_TRUE(HasLocalTime(r.earliest, zone, d.year(), d.month(),
+                                 d.day(), d.hour(), d.minute()))
+            << d;
+        break;
+      }
+      case LocalTimeResolution::kAmbiguous: {
+        ++ambiguous;
+        ASSERT_LT(r.earliest, r.latest);
+        ASSERT_TRUE(HasLocalTime(r.earliest, zone, d.year(), d.month(),
+                                 d.day(), d.hour(), d.minute()))
+            << d;
+        ASSERT_TRUE(HasLocalTime(r.latest, zone, d.year(), d.month(), d.day(),
+                                 d.hour(), d.minute()))
+            << d;
+        break;
+      }
+      case LocalTimeResolution::kSkipped: {
+        ++skipped;
+        // Equal when the requested time is the start of the gap.
+        ASSERT_LE(r.earliest, r.latest);
+        // The offset changes exactly at `earliest`.
+        ASSERT_NE(zone.timeZoneAt(r.earliest - Micros(1)).offset(),
+                  zone.timeZoneAt(r.earliest).offset());
+        break;
+      }
+    }
+  }
+  // One hour per year, at 15-minute resolution.
+  EXPECT_EQ(4 * (to_year - from_year + 1), skipped);
+  EXPECT_EQ(4 * (to_year - from_year + 1), ambiguous);
+}
+
+// Forwards to another zone, counting the lookups.
+class CountingZone : public TimeZoneRules {
+ public:
+  explicit CountingZone(const TimeZoneRules& zone) : zone_(zone), lookups_(0) {}
+
+  TimeZone timeZoneAt(WallTime t) const override {
+    ++lookups_;
+    return zone_.timeZoneAt(t);
+  }
+
+  bool transitionBetween(WallTime lo, WallTime hi,
+                         WallTime* transition) const override {
+    ++lookups_;
+    return zone_.transitionBetween(lo, hi, transition);
+  }
+
+  int lookups() const { return lookups_; }
+
+ private:
+  const TimeZoneRules& zone_;
+  mutable int lookups_;
+};
+
+}  // namespace
+
+TEST(ResolveLocalTime, FixedOffset) {
+  LocalTimeResolution r = Resolve(2024, 7, 1, 12, 0, tzdb::Asia_Tokyo);
+  EXPECT_EQ(LocalTimeResolution::kUnique, r.kind);
+  EXPECT_EQ(Utc(2024, 7, 1, 3, 0), r.earliest);
+  EXPECT_EQ(Utc(2024, 7, 1, 3, 0), r.latest);
+}
+
+TEST(ResolveLocalTime, Unique) {
+  // Winter and summer time.
+  LocalTimeResolution r = Resolve(2024, 1, 15, 12, 0, tzdb::Europe_Warsaw);
+  EXPECT_EQ(LocalTimeResolution::kUnique, r.kind);
+  EXPECT_EQ(Utc(2024, 1, 15, 11, 0), r.earliest);
+  r = Resolve(2024, 7, 15, 12, 0, tzdb::Europe_Warsaw);
+  EXPECT_EQ(LocalTimeResolution::kUnique, r.kind);
+  EXPECT_EQ(Utc(2024, 7, 15, 10, 0), r.earliest);
+  // Close to the transitions.
+  r = Resolve(2024, 3, 31, 1, 59, tzdb::Europe_Warsaw);
+  EXPECT_EQ(LocalTimeResolution::kUnique, r.kind);
+  EXPECT_EQ(Utc(2024, 3, 31, 0, 59), r.earliest);
+  r = Resolve(2024, 3, 31, 3, 0, tzdb::Europe_Warsaw);
+  EXPECT_EQ(LocalTimeResolution::kUnique, r.kind);
+  EXPECT_EQ(Utc(2024, 3, 31, 1, 0), r.earliest);
+  r = Resolve(2024, 10, 27, 3, 0, tzdb::Europe_Warsaw);
+  EXPECT_EQ(LocalTimeResolution::kUnique, r.kind);
+  EXPECT_EQ(Utc(2024, 10, 27, 2, 0), r.earliest);
+}
+
+TEST(ResolveLocalTime, Skipped) {
+  // 02:30 does not exist on 2024-03-31 in Poland.
+  LocalTimeResolution r = Resolve(2024, 3, 31, 2, 30, tzdb::Europe_Warsaw);
+  EXPECT_EQ(LocalTimeResolution::kSkipped, r.kind);
+  EXPECT_EQ(Utc(2024, 3, 31, 1, 0), r.earliest);
+  EXPECT_EQ(Utc(2024, 3, 31, 1, 30), r.latest);
+}
+
+TEST(ResolveLocalTime, SkippedTakesBoundedLookups) {
+  CountingZone zone(tzdb::Europe_Warsaw);
+  LocalTimeResolution r = Resolve(2024, 3, 31, 2, 30, zone);
+  EXPECT_EQ(LocalTimeResolution::kSkipped, r.kind);
+  EXPECT_EQ(Utc(2024, 3, 31, 1, 0), r.earliest);
+  // Four offset lookups, and one transition lookup.
+  EXPECT_EQ(5, zone.lookups());
+}
+
+TEST(ResolveLocalTime, Ambiguous) {
+  // 02:30 occurs twice on 2024-10-27 in Poland.
+  LocalTimeResolution r = Resolve(2024, 10, 27, 2, 30, tzdb::Europe_Warsaw);
+  EXPECT_EQ(LocalTimeResolution::kAmbiguous, r.kind);
+  EXPECT_EQ(Utc(2024, 10, 27, 0, 30), r.earliest);
+  EXPECT_EQ(Utc(2024, 10, 27, 1, 30), r.latest);
+}
+
+TEST(ResolveLocalTime, SouthernHemisphere) {
+  // Sydney: DST ends at 03:00 on the first Sunday of April, and starts at
+  // 02:00 on the first Sunday of October.
+  LocalTimeResolution r = Resolve(2024, 4, 7, 2, 30, tzdb::Australia_Sydney);
+  EXPECT_EQ(LocalTimeResolution::kAmbiguous, r.kind);
+  EXPECT_EQ(Utc(2024, 4, 6, 15, 30), r.earliest);
+  EXPECT_EQ(Utc(2024, 4, 6, 16, 30), r.latest);
+  r = Resolve(2024, 10, 6, 2, 30, tzdb::Australia_Sydney);
+  EXPECT_EQ(LocalTimeResolution::kSkipped, r.kind);
+  EXPECT_EQ(Utc(2024, 10, 5, 16, 0), r.earliest);
+  EXPECT_EQ(Utc(2024, 10, 5, 16, 30), r.latest);
+}
+
+TEST(ResolveLocalTime, ConsistentWithForwardConversion) {
+  ExpectConsistent(tzdb::Europe_Warsaw, 2020, 2025);
+  ExpectConsistent(tzdb::America_New_York, 2020, 2025);
+  ExpectConsistent(tzdb::Australia_Sydney, 2021, 2025);
+  PosixTimeZone zone;
+  ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  ExpectConsistent(zone, 2020, 2025);
+}
+
+TEST(WallTimeFromLocal, Policies) {
+  WallTime t;
+  // Unique times are accepted under any policy.
+  for (LocalTimePolicy policy :
+       {LocalTimePolicy::kEarliest, LocalTimePolicy::kLatest,
+        LocalTimePolicy::kReject}) {
+    ASSERT_TRUE(WallTimeFromLocal(2024, 7, 15, 12, 0, 0, 0,
+                                  tzdb::Europe_Warsaw, policy, &t));
+    EXPECT_EQ(Utc(2024, 7, 15, 10, 0), t);
+  }
+
+  ASSERT_TRUE(WallTimeFromLocal(2024, 10, 27, 2, 30, 0, 0, tzdb::Europe_Warsaw,
+                                LocalTimePolicy::kEarliest, &t));
+  EXPECT_EQ(Utc(2024, 10, 27, 0, 30), t);
+  ASSERT_TRUE(WallTimeFromLocal(2024, 10, 27, 2, 30, 0, 0, tzdb::Europe_Warsaw,
+                                LocalTimePolicy::kLatest, &t));
+  EXPECT_EQ(Utc(2024, 10, 27, 1, 30), t);
+
+  ASSERT_TRUE(WallTimeFromLocal(2024, 3, 31, 2, 30, 0, 0, tzdb::Europe_Warsaw,
+                                LocalTimePolicy::kEarliest, &t));
+  EXPECT_EQ(Utc(2024, 3, 31, 1, 0), t);
+  ASSERT_TRUE(WallTimeFromLocal(2024, 3, 31, 2, 30, 0, 0, tzdb::Europe_Warsaw,
+                                LocalTimePolicy::kLatest, &t));
+  EXPECT_EQ(Utc(2024, 3, 31, 1, 30), t);
+
+  t = WallTime();
+  EXPECT_FALSE(WallTimeFromLocal(2024, 10, 27, 2, 30, 0, 0,
+                                 tzdb::Europe_Warsaw, LocalTimePolicy::kReject,
+                                 &t));
+  EXPECT_FALSE(WallTimeFromLocal(2024, 3, 31, 2, 30, 0, 0, tzdb::Europe_Warsaw,
+                                 LocalTimePolicy::kReject, &t));
+  EXPECT_EQ(WallTime(), t);
+}
+
+}  // namespace roo_time
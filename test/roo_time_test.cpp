@@ -1,3 +1,4 @@
+#include "date_time_testing.h"
 #include "gtest/gtest.h"
 
 #include "roo_time.h"
@@ -205,6 +206,95 @@ TEST(DateTime, FromUnixCest) {
   EXPECT_EQ(1590443851000001, d.wallTime().sinceEpoch().inMicros());
 }
 
+TEST(DateTime, FromUnixBeforeEpoch) {
+  DateTime d(WallTime(Micros(-1)), timezone::UTC);
+  EXPECT_EQ(1969, d.year());
+  EXPECT_EQ(kDecember, d.month());
+  EXPECT_EQ(31, d.day());
+  EXPECT_EQ(23, d.hour());
+  EXPECT_EQ(59, d.minute());
+  EXPECT_EQ(59, d.second());
+  EXPECT_EQ(999999, d.micros());
+  EXPECT_EQ(kWednesday, d.dayOfWeek());
+  EXPECT_EQ(365, d.dayOfYear());
+
+  DateTime e(WallTime(Minutes(-30)), TimeZone(Hours(-5)));
+  EXPECT_EQ(1969, e.year());
+  EXPECT_EQ(31, e.day());
+  EXPECT_EQ(18, e.hour());
+  EXPECT_EQ(30, e.minute());
+}
+
+TEST(DateTime, PlusDuration) {
+  TimeZone tz(Hours(2));
+  DateTime d(2020, 05, 25, 23, 57, 31, 1, tz);
+  ExpectSameFields(DateTime(2020, 05, 25, 23, 58, 31, 2, tz),
+                   d.plus(Minutes(1) + Micros(1)));
+  ExpectSameFields(DateTime(2020, 05, 26, 0, 0, 1, 1, tz),
+                   d.plus(Seconds(150)));
+  ExpectSameFields(DateTime(2020, 05, 25, 0, 0, 0, 0, tz),
+                   d.plus(Hours(-23) - Minutes(57) - Seconds(31) - Micros(1)));
+  ExpectSameFields(DateTime(2020, 05, 24, 23, 59, 59, 999999, tz),
+                   d.plus(Hours(-23) - Minutes(57) - Seconds(31) - Micros(2)));
+  for (int i = -5000; i < 5000; ++i) {
+    Duration delta = Seconds(i * 37) + Micros(i);
+    ExpectSameFields(DateTime(d.wallTime() + delta, tz), d.plus(delta));
+  }
+}
+
+TEST(DateTime, PlusDays) {
+  TimeZone tz(Hours(-7));
+  DateTime d(2020, 2, 27, 13, 14, 15, 16, tz);
+  ExpectSameFields(DateTime(2020, 2, 29, 13, 14, 15, 16, tz), d.plusDays(2));
+  ExpectSameFields(DateTime(2020, 3, 1, 13, 14, 15, 16, tz), d.plusDays(3));
+  ExpectSameFields(DateTime(2019, 12, 31, 13, 14, 15, 16, tz),
+                   d.plusDays(-58));
+  for (int i = -2000; i < 2000; i += 3) {
+    ExpectSameFields(DateTime(d.wallTime() + Hours(24 * i), tz),
+                     d.plusDays(i));
+  }
+}
+
+TEST(DateTime, PlusMonths) {
+  TimeZone tz(Hours(1));
+  DateTime jan31(2020, 1, 31, 10, 0, 0, 0, tz);
+  ExpectSameFields(DateTime(2020, 2, 29, 10, 0, 0, 0, tz),
+                   jan31.plusMonths(1));
+  ExpectSameFields(DateTime(2020, 3, 31, 10, 0, 0, 0, tz),
+                   jan31.plusMonths(2));
+  ExpectSameFields(DateTime(2020, 4, 30, 10, 0, 0, 0, tz),
+                   jan31.plusMonths(3));
+  ExpectSameFields(DateTime(2021, 2, 28, 10, 0, 0, 0, tz),
+                   jan31.plusMonths(13));
+  ExpectSameFields(DateTime(2019, 12, 31, 10, 0, 0, 0, tz),
+                   jan31.plusMonths(-1));
+  ExpectSameFields(DateTime(2019, 11, 30, 10, 0, 0, 0, tz),
+                   jan31.plusMonths(-2));
+  ExpectSameFields(DateTime(2000, 1, 31, 10, 0, 0, 0, tz),
+                   jan31.plusMonths(-240));
+
+  DateTime d(1999, 6, 15, 1, 2, 3, 4, tz);
+  for (int i = 0; i < 600; ++i) {
+    DateTime next = d.plusMonths(1);
+    ExpectSameFields(DateTime(i % 12 == 6 ? d.year() + 1 : d.year(),
+                              d.month() % 12 + 1, 15, 1, 2, 3, 4, tz),
+                     next);
+    d = next;
+  }
+}
+
+TEST(DateTime, PlusYears) {
+  DateTime leap(2024, 2, 29, 12, 0, 0, 0, timezone::UTC);
+  ExpectSameFields(DateTime(2025, 2, 28, 12, 0, 0, 0, timezone::UTC),
+                   leap.plusYears(1));
+  ExpectSameFields(DateTime(2028, 2, 29, 12, 0, 0, 0, timezone::UTC),
+                   leap.plusYears(4));
+  ExpectSameFields(DateTime(2100, 2, 28, 12, 0, 0, 0, timezone::UTC),
+                   leap.plusYears(76));
+  ExpectSameFields(DateTime(2000, 2, 29, 12, 0, 0, 0, timezone::UTC),
+                   leap.plusYears(-24));
+}
+
 TEST(DateTime, ComparisonSemantics) {
   DateTime same_instant_different_tz(WallTime(Micros(1590443851000001)),
                                      TimeZone(Hours(2)));
@@ -216,4 +306,73 @@ TEST(DateTime, ComparisonSemantics) {
   EXPECT_NE(same_instant_different_tz, same_tz_different_instant);
 }
 
+namespace {
+
+constexpr TimeZone kCet(Hours(1));
+constexpr TimeZone kCest(Hours(2));
+
+// Example of a table of DST transitions computed at compile time.
+constexpr WallTime kTransitions[] = {
+    WallTimeFromCivil(2024, 3, 31, 2, 0, 0, 0, kCet),
+    WallTimeFromCivil(2024, 10, 27, 3, 0, 0, 0, kCest),
+};
+
+}  // namespace
+
+TEST(Constexpr, Duration) {
+  static_assert(Seconds(3) + Millis(5) == Micros(3005000), "");
+  static_assert(Hours(1) - Minutes(30) > Minutes(29), "");
+  static_assert(Minutes(2) * 3 == 3 * Minutes(2), "");
+  static_assert(Duration::Max().inMicros() == 0x7FFFFFFFFFFFFFFF, "");
+}
+
+TEST(Constexpr, Uptime) {
+  constexpr Uptime start = Uptime::Start();
+  constexpr Uptime later = start + Seconds(5);
+  static_assert(later - start == Seconds(5), "");
+  static_assert(later.inMillis() == 5000, "");
+  static_assert(later > start, "");
+  static_assert(Uptime::Max() > later, "");
+  static_assert((Seconds(2) + later - Seconds(1)).inSeconds() == 6, "");
+}
+
+TEST(Constexpr, WallTime) {
+  constexpr WallTime epoch;
+  constexpr WallTime t = epoch + Hours(24);
+  static_assert(t - epoch == Hours(24), "");
+  static_assert(t != epoch, "");
+  static_assert(WallTimeFromCivil(1970, 1, 2, timezone::UTC) == t, "");
+}
+
+TEST(Constexpr, DateTime) {
+  constexpr DateTime d(2020, 05, 25, 23, 57, 31, 1, kCest);
+  static_assert(d.wallTime().sinceEpoch().inMicros() == 1590443851000001, "");
+  static_assert(d.dayOfWeek() == kMonday, "");
+  static_assert(d.dayOfYear() == 146, "");
+
+  constexpr DateTime from_wall(WallTime(Micros(1590443851000001)), kCest);
+  static_assert(from_wall == d, "");
+  static_assert(from_wall.year() == 2020, "");
+  static_assert(from_wall.month() == kMay, "");
+  static_assert(from_wall.day() == 25, "");
+  static_assert(from_wall.hour() == 23, "");
+  static_assert(from_wall.minute() == 57, "");
+  static_assert(from_wall.second() == 31, "");
+  static_assert(from_wall.micros() == 1, "");
+
+  static_assert(DateTime(2024, 1, 1, 0, 0, 0, 0, timezone::UTC)
+                        .wallTime()
+                        .sinceEpoch()
+                        .inSeconds() == 1704067200,
+                "");
+  static_assert(DateTime(2024, 1, 31, kCet).plusMonths(1).day() == 29, "");
+  static_assert(DateTime(2024, 1, 31, kCet).plusDays(1).month() == kFebruary,
+                "");
+  static_assert(d.plus(Minutes(3)).day() == 26, "");
+
+  // Both transitions happen at 01:00 UTC.
+  static_assert(kTransitions[1] - kTransitions[0] == Hours(24 * 210), "");
+  EXPECT_EQ(DateTime(kTransitions[0], kCest).hour(), 3);
+}
+
 }  // namespace roo_time
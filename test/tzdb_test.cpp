@@ -0,0 +1,202 @@
+#include "roo_time/tzdb.h"
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+#include "roo_time/posix_tz.h"
+#include "roo_time/tzdb/zones.h"
+
+namespace roo_time {
+
+namespace {
+
+Duration OffsetAt(const TimeZoneRules& zone, WallTime t) {
+  return zone.timeZoneAt(t).offset();
+}
+
+}  // namespace
+
+TEST(Tzdb, EuropeWarsaw) {
+  // Summer time starts at 01:00 UTC, on the last Sunday of March.
+  WallTime start = WallTimeFromCivil(2024, 3, 31, 1, 0, 0, 0, timezone::UTC);
+  EXPECT_EQ(Hours(1), OffsetAt(tzdb::Europe_Warsaw, start - Micros(1)));
+  EXPECT_EQ(Hours(2), OffsetAt(tzdb::Europe_Warsaw, start));
+  // ... and ends at 01:00 UTC, on the last Sunday of October.
+  WallTime end = WallTimeFromCivil(2024, 10, 27, 1, 0, 0, 0, timezone::UTC);
+  EXPECT_EQ(Hours(2), OffsetAt(tzdb::Europe_Warsaw, end - Micros(1)));
+  EXPECT_EQ(Hours(1), OffsetAt(tzdb::Europe_Warsaw, end));
+}
+
+TEST(Tzdb, AmericaNewYork) {
+  WallTime start = WallTimeFromCivil(2024, 3, 10, 7, 0, 0, 0, timezone::UTC);
+  EXPECT_EQ(Hours(-5), OffsetAt(tzdb::America_New_York, start - Seconds(1)));
+  EXPECT_EQ(Hours(-4), OffsetAt(tzdb::America_New_York, start));
+  // Before the 2007 rule change, DST started on the first Sunday of April.
+  EXPECT_EQ(Hours(-5),
+            OffsetAt(tzdb::America_New_York,
+                     WallTimeFromCivil(2006, 3, 20, timezone::UTC)));
+  EXPECT_EQ(Hours(-4),
+            OffsetAt(tzdb::America_New_York,
+                     WallTimeFromCivil(2007, 3, 20, timezone::UTC)));
+}
+
+TEST(Tzdb, SouthernHemisphere) {
+  EXPECT_EQ(Hours(11), OffsetAt(tzdb::Australia_Sydney,
+                                WallTimeFromCivil(2024, 1, 15, timezone::UTC)));
+  EXPECT_EQ(Hours(10), OffsetAt(tzdb::Australia_Sydney,
+                                WallTimeFromCivil(2024, 7, 15, timezone::UTC)));
+}
+
+TEST(Tzdb, FixedOffsetZones) {
+  EXPECT_EQ(0, tzdb::Asia_Kolkata.transitionCount());
+  EXPECT_EQ(Minutes(330), OffsetAt(tzdb::Asia_Kolkata, WallTime()));
+  EXPECT_EQ(Hours(9), OffsetAt(tzdb::Asia_Tokyo,
+                               WallTimeFromCivil(2024, 7, 15, timezone::UTC)));
+}
+
+TEST(Tzdb, OutsideCoveredRange) {
+  // Before the first transition.
+  EXPECT_EQ(Hours(1), OffsetAt(tzdb::Europe_Warsaw,
+                               WallTimeFromCivil(1960, 1, 1, timezone::UTC)));
+  // After the end of the table, from the POSIX TZ rule.
+  EXPECT_EQ(WallTimeFromCivil(2038, 1, 1, timezone::UTC),
+            tzdb::Europe_Warsaw.tableEnd());
+  EXPECT_EQ(Hours(2), OffsetAt(tzdb::Europe_Warsaw,
+                               WallTimeFromCivil(2100, 7, 1, timezone::UTC)));
+  EXPECT_EQ(Hours(1), OffsetAt(tzdb::Europe_Warsaw,
+                               WallTimeFromCivil(2100, 12, 1, timezone::UTC)));
+  EXPECT_TRUE(tzdb::Europe_Warsaw.covers(
+      WallTimeFromCivil(2100, 1, 1, timezone::UTC)));
+  EXPECT_EQ(Hours(-3),
+            OffsetAt(tzdb::America_Sao_Paulo,
+                     WallTimeFromCivil(2050, 1, 1, timezone::UTC)));
+}
+
+TEST(Tzdb, PosixRuleMatchesTable) {
+  // The rule continues the table seamlessly.
+  for (const TzdbTimeZone* zone :
+       {&tzdb::Europe_London, &tzdb::Australia_Sydney,
+        &tzdb::America_New_York}) {
+    ASSERT_NE(nullptr, zone->posixRule());
+    PosixTimeZone rule;
+    ASSERT_TRUE(rule.parse(zone->posixRule()));
+    for (WallTime t = WallTimeFromCivil(2030, 1, 1, timezone::UTC);
+         t < zone->tableEnd(); t += Hours(1)) {
+      ASSERT_EQ(OffsetAt(rule, t), OffsetAt(*zone, t)) << zone->name();
+    }
+  }
+}
+
+TEST(Tzdb, TransitionsContinueAfterTable) {
+  // Summer time in 2040 starts on March 25, at 01:00 UTC.
+  WallTime start = WallTimeFromCivil(2040, 3, 25, 1, 0, 0, 0, timezone::UTC);
+  EXPECT_EQ(Hours(1), OffsetAt(tzdb::Europe_Berlin, start - Micros(1)));
+  EXPECT_EQ(Hours(2), OffsetAt(tzdb::Europe_Berlin, start));
+  DateTime dt(WallTimeFromCivil(2045, 7, 1, 12, 0, 0, 0, timezone::UTC),
+              tzdb::America_Los_Angeles);
+  EXPECT_EQ(5, dt.hour());
+}
+
+TEST(Tzdb, ZoneWithoutRule) {
+  int32_t transitions[] = {100};
+  int16_t offsets[] = {60, 120};
+  TzdbTimeZone zone("Test/Zone", transitions, offsets, 1, 1000, nullptr);
+  EXPECT_TRUE(zone.covers(WallTime(Seconds(999))));
+  EXPECT_FALSE(zone.covers(WallTime(Seconds(1000))));
+  // Repeats the last offset.
+  EXPECT_EQ(Hours(2), OffsetAt(zone, WallTime(Seconds(5000))));
+  TzdbTimeZone bad("Test/Bad", transitions, offsets, 1, 1000, "???");
+  EXPECT_FALSE(bad.covers(WallTime(Seconds(1000))));
+  EXPECT_EQ(Hours(2), OffsetAt(bad, WallTime(Seconds(5000))));
+}
+
+TEST(Tzdb, TransitionBetween) {
+  const TzdbTimeZone& zone = tzdb::Europe_Warsaw;
+  WallTime start = WallTimeFromCivil(2024, 3, 31, 1, 0, 0, 0, timezone::UTC);
+  WallTime t;
+  ASSERT_TRUE(zone.transitionBetween(start - Hours(24), start + Hours(24), &t));
+  EXPECT_EQ(start, t);
+  // The interval is open on the left, and closed on the right.
+  ASSERT_TRUE(zone.transitionBetween(start - Micros(1), start, &t));
+  EXPECT_EQ(start, t);
+  t = WallTime();
+  EXPECT_FALSE(zone.transitionBetween(start, start + Hours(24), &t));
+  EXPECT_FALSE(
+      zone.transitionBetween(start - Hours(24), start - Micros(1), &t));
+  EXPECT_EQ(WallTime(), t);
+  // Returns the first one.
+  ASSERT_TRUE(zone.transitionBetween(start - Hours(24), start + Hours(24 * 365),
+                                     &t));
+  EXPECT_EQ(start, t);
+  EXPECT_FALSE(tzdb::Asia_Kolkata.transitionBetween(
+      WallTime(), WallTimeFromCivil(2100, 1, 1, timezone::UTC), &t));
+}
+
+TEST(Tzdb, TransitionBetweenAfterTable) {
+  const TzdbTimeZone& zone = tzdb::Europe_Warsaw;
+  // Summer time in 2038 starts on March 28, at 01:00 UTC.
+  WallTime start = WallTimeFromCivil(2038, 3, 28, 1, 0, 0, 0, timezone::UTC);
+  WallTime t;
+  ASSERT_TRUE(zone.transitionBetween(zone.tableEnd() - Hours(24),
+                                     start + Hours(1), &t));
+  EXPECT_EQ(start, t);
+  ASSERT_TRUE(zone.transitionBetween(start - Hours(1), start + Hours(1), &t));
+  EXPECT_EQ(start, t);
+  EXPECT_FALSE(zone.transitionBetween(zone.tableEnd() - Hours(24),
+                                      start - Micros(1), &t));
+}
+
+TEST(Tzdb, TransitionBetweenMatchesDefault) {
+  // A zone that inherits the default, bisecting implementation.
+  class Bisecting : public TimeZoneRules {
+   public:
+    explicit Bisecting(const TimeZoneRules& zone) : zone_(zone) {}
+    TimeZone timeZoneAt(WallTime t) const override {
+      return zone_.timeZoneAt(t);
+    }
+
+   private:
+    const TimeZoneRules& zone_;
+  };
+  Bisecting bisecting(tzdb::America_New_York);
+  uint32_t state = 12345;
+  for (int i = 0; i < 2000; ++i) {
+    state = state * 1664525 + 1013904223;
+    WallTime lo = WallTimeFromCivil(2000, 1, 1, timezone::UTC) +
+                  Seconds(state % (50 * 365 * 86400U)) + Micros(state % 997);
+    WallTime hi = lo + Hours(48);
+    WallTime expected;
+    WallTime actual;
+    bool found = bisecting.transitionBetween(lo, hi, &expected);
+    ASSERT_EQ(found, tzdb::America_New_York.transitionBetween(lo, hi, &actual))
+        << lo;
+    if (found) {
+      ASSERT_EQ(expected, actual) << lo;
+    }
+  }
+}
+
+TEST(Tzdb, TransitionsAreSorted) {
+  const TzdbTimeZone& zone = tzdb::Europe_London;
+  ASSERT_GT(zone.transitionCount(), 100);
+  for (uint16_t i = 1; i < zone.transitionCount(); ++i) {
+    EXPECT_LT(zone.transition(i - 1), zone.transition(i));
+    // The offset changes exactly at each transition.
+    EXPECT_NE(OffsetAt(zone, zone.transition(i) - Seconds(1)),
+              OffsetAt(zone, zone.transition(i)));
+  }
+}
+
+TEST(Tzdb, DateTimeWithRules) {
+  DateTime dt(WallTimeFromCivil(2024, 7, 1, 12, 0, 0, 0, timezone::UTC),
+              tzdb::Europe_Berlin);
+  EXPECT_EQ(14, dt.hour());
+  EXPECT_EQ(Hours(2), dt.timeZone().offset());
+}
+
+TEST(Tzdb, FindByName) {
+  EXPECT_EQ(&tzdb::Europe_Warsaw, FindTzdbZone("Europe/Warsaw"));
+  EXPECT_EQ(&tzdb::America_Los_Angeles, FindTzdbZone("America/Los_Angeles"));
+  EXPECT_EQ(nullptr, FindTzdbZone("Mars/Olympus_Mons"));
+}
+
+}  // namespace roo_time
@@ -0,0 +1,94 @@
+#include "roo_time/uptime32.h"
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+static_assert(sizeof(Uptime32) == 4, "");
+static_assert(sizeof(Duration32) == 4, "");
+
+namespace {
+
+constexpr int64_t kWrapMillis = 1LL << 32;
+
+Uptime UptimeMillis(int64_t millis) { return Uptime::Start() + Millis(millis); }
+
+}  // namespace
+
+TEST(Uptime32, Conversions) {
+  Uptime32 t(UptimeMillis(1234) + Micros(999));
+  EXPECT_EQ(1234u, t.rawMillis());
+  EXPECT_EQ(t, Uptime32::FromRawMillis(1234));
+  EXPECT_EQ(0u, Uptime32().rawMillis());
+  // Wraps around.
+  EXPECT_EQ(5u, Uptime32(UptimeMillis(kWrapMillis + 5)).rawMillis());
+  EXPECT_EQ(0xFFFFFFFFu, Uptime32(UptimeMillis(-1)).rawMillis());
+}
+
+TEST(Uptime32, ToUptime) {
+  Uptime reference = UptimeMillis(3 * kWrapMillis + 1000);
+  // Within 2^31 ms of the reference, the full uptime is recovered exactly,
+  // also across the wrap-around.
+  for (int64_t offset : {0LL, 1LL, -1LL, -1000LL, -1001LL, 1000000LL,
+                         (1LL << 31) - 1, -(1LL << 31)}) {
+    Uptime actual = reference + Millis(offset);
+    EXPECT_EQ(actual, Uptime32(actual).toUptime(reference)) << offset;
+  }
+}
+
+TEST(Uptime32, Arithmetic) {
+  Uptime32 t = Uptime32::FromRawMillis(0xFFFFFFF0u);
+  Uptime32 later = t + Seconds(1);
+  EXPECT_EQ(1000u - 0x10u, later.rawMillis());
+  EXPECT_EQ(Duration32(1000), later - t);
+  EXPECT_EQ(Duration32(-1000), t - later);
+  EXPECT_EQ(Millis(1000), later - t);
+  EXPECT_EQ(t, later - Seconds(1));
+  EXPECT_EQ(later, t + Duration32(1000));
+  EXPECT_EQ(t, later - Duration32(1000));
+  // Sub-millisecond parts of durations are truncated.
+  EXPECT_EQ(t + Millis(1), t + Micros(1999));
+  // Durations longer than the wrap-around period are applied modulo 2^32 ms.
+  EXPECT_EQ(t + Millis(7), t + Millis(kWrapMillis + 7));
+  Uptime32 u = t;
+  u += Duration32(20);
+  u -= Millis(5);
+  EXPECT_EQ(t + Millis(15), u);
+}
+
+TEST(Uptime32, Comparisons) {
+  Uptime32 t = Uptime32::FromRawMillis(0xFFFFFF00u);
+  Uptime32 later = t + Millis(0x200);
+  EXPECT_EQ(0x100u, later.rawMillis());
+  EXPECT_TRUE(t < later);
+  EXPECT_TRUE(t <= later);
+  EXPECT_TRUE(later > t);
+  EXPECT_TRUE(later >= t);
+  EXPECT_FALSE(later < t);
+  EXPECT_FALSE(t > later);
+  EXPECT_TRUE(t != later);
+  EXPECT_TRUE(t <= t);
+  EXPECT_FALSE(t < t);
+}
+
+TEST(Uptime32, MatchesUptime) {
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<int64_t> base(0, 1LL << 40);
+  std::uniform_int_distribution<int64_t> offset(-(1LL << 31) + 1,
+                                                (1LL << 31) - 1);
+  for (int i = 0; i < 100000; ++i) {
+    Uptime a = UptimeMillis(base(gen));
+    Uptime b = a + Millis(offset(gen));
+    Uptime32 a32(a);
+    Uptime32 b32(b);
+    ASSERT_EQ(a < b, a32 < b32);
+    ASSERT_EQ(a == b, a32 == b32);
+    ASSERT_EQ(b - a, b32 - a32);
+    ASSERT_EQ(b, b32.toUptime(a));
+  }
+}
+
+}  // namespace roo_time
@@ -0,0 +1,158 @@
+#include "roo_time/internal/uptime_extension.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace roo_time {
+namespace internal {
+
+namespace {
+
+// Number of concurrent callers in the stress tests.
+constexpr int kThreads = 4;
+
+}  // namespace
+
+TEST(CounterExtender32, Sequential) {
+  CounterExtender32 extender;
+  uint64_t ticks = 0;
+  auto counter = [&] { return (uint32_t)ticks; };
+  EXPECT_EQ(0u, extender.extend(counter));
+  ticks = 0x7FFFFFFF;
+  EXPECT_EQ(ticks, extender.extend(counter));
+  ticks = 0xFFFFFFFF;
+  EXPECT_EQ(ticks, extender.extend(counter));
+  ticks = 0x100000005;
+  EXPECT_EQ(ticks, extender.extend(counter));
+  // Repeated readings don't change anything.
+  EXPECT_EQ(ticks, extender.extend(counter));
+  for (int i = 0; i < 100; ++i) {
+    ticks += 0x7FFFFFFF;
+    ASSERT_EQ(ticks, extender.extend(counter));
+  }
+}
+
+TEST(CounterExtender32, MissedHalfPeriod) {
+  // Documented limitation: wrap-arounds go unnoticed if the counter is not
+  // extended at least once per half-period.
+  CounterExtender32 extender;
+  uint64_t ticks = 0x80000000;
+  auto counter = [&] { return (uint32_t)ticks; };
+  EXPECT_EQ(ticks, extender.extend(counter));
+  ticks += 0x80000000;
+  EXPECT_EQ(ticks, extender.extend(counter));
+  ticks += 0x100000000;
+  EXPECT_EQ(0x100000000u, extender.extend(counter));
+}
+
+// Simulates a wrapping 32-bit counter that is advanced by large steps, and
+// read concurrently by several threads. Checks that each extended reading
+// matches the true 64-bit count at some point during the call.
+TEST(CounterExtender32, ConcurrentStress) {
+  constexpr int kSteps = 5000;
+  CounterExtender32 extender;
+  std::atomic<uint64_t> ticks(0);
+  std::atomic<bool> done(false);
+  std::atomic<int64_t> calls[kThreads];
+  for (auto& c : calls) c.store(0);
+  std::atomic<int> failures(0);
+
+  std::vector<std::thread> readers;
+  for (int t = 0; t < kThreads; ++t) {
+    readers.emplace_back([&, t] {
+      uint64_t previous = 0;
+      uint32_t state = t;
+      while (!done.load()) {
+        uint64_t before = ticks.load();
+        uint64_t extended =
+            extender.extend([&] { return (uint32_t)ticks.load(); });
+        uint64_t after = ticks.load();
+        if (extended < before || extended > after || extended < previous) {
+          failures.fetch_add(1);
+        }
+        previous = extended;
+        calls[t].fetch_add(1);
+        // Lets the counter advance, also on a single core. Yields at random,
+        // to vary the interleaving.
+        state = state * 1664525 + 1013904223;
+        if (state & 0x80000000) std::this_thread::yield();
+      }
+    });
+  }
+  // Advances the counter by up to 2^29 at a time, wrapping around every ~16
+  // steps. Waits for each reader to complete a call between steps, so that
+  // no call spans more than two steps, i.e. less than half a period.
+  uint32_t state = 12345;
+  for (int step = 0; step < kSteps; ++step) {
+    state = state * 1664525 + 1013904223;
+    ticks.fetch_add(state >> 3);
+    int64_t snapshot[kThreads];
+    for (int t = 0; t < kThreads; ++t) snapshot[t] = calls[t].load();
+    for (int t = 0; t < kThreads; ++t) {
+      while (calls[t].load() == snapshot[t]) std::this_thread::yield();
+    }
+  }
+  done.store(true);
+  for (auto& r : readers) r.join();
+  // Many wrap-arounds.
+  EXPECT_GT(ticks.load() >> 32, 100u);
+  EXPECT_EQ(0, failures.load());
+  EXPECT_EQ(ticks.load(),
+            extender.extend([&] { return (uint32_t)ticks.load(); }));
+}
+
+TEST(MonotoneAdjuster, Sequential) {
+  MonotoneAdjuster adjuster;
+  int64_t clock = 1000;
+  auto read = [&] { return clock; };
+  EXPECT_EQ(1000, adjuster.adjust(read));
+  clock = 2000;
+  EXPECT_EQ(2000, adjuster.adjust(read));
+  // The clock steps backwards; the adjusted clock holds, and then continues
+  // from there.
+  clock = 500;
+  EXPECT_EQ(2000, adjuster.adjust(read));
+  clock = 600;
+  EXPECT_EQ(2100, adjuster.adjust(read));
+  clock = 10000;
+  EXPECT_EQ(11500, adjuster.adjust(read));
+}
+
+// Several threads read a clock that keeps stepping backwards, while checking
+// that the adjusted values they see never decrease.
+TEST(MonotoneAdjuster, ConcurrentStress) {
+  constexpr int kCalls = 200000;
+  MonotoneAdjuster adjuster;
+  std::atomic<int64_t> clock(0);
+  std::atomic<int> failures(0);
+  std::atomic<int64_t> published(INT64_MIN);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      uint32_t state = t;
+      int64_t previous = INT64_MIN;
+      for (int i = 0; i < kCalls; ++i) {
+        state = state * 1664525 + 1013904223;
+        // Mostly forward, sometimes backward.
+        clock.fetch_add((int64_t)(state >> 24) - 32);
+        int64_t seen = published.load();
+        int64_t now = adjuster.adjust([&] { return clock.load(); });
+        // Monotone per thread, and with respect to values returned to other
+        // threads before this call.
+        if (now < previous || now < seen) failures.fetch_add(1);
+        previous = now;
+        int64_t p = published.load();
+        while (p < now && !published.compare_exchange_weak(p, now)) {
+        }
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+  EXPECT_EQ(0, failures.load());
+}
+
+}  // namespace internal
+}  // namespace roo_time
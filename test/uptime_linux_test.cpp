@@ -0,0 +1,154 @@
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+#include "roo_time/internal/tsc_clock.h"
+
+namespace roo_time {
+
+namespace {
+
+constexpr int kThreads = 4;
+
+int64_t MonotonicMicros() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Calls `now()` concurrently from several threads, for about `duration`, and
+// checks that each call returns at least what any call that completed before
+// it returned.
+template <typename Now>
+void ExpectMonotoneAcrossThreads(Now&& now, Duration duration) {
+  std::atomic<int64_t> published(INT64_MIN);
+  std::atomic<int> failures(0);
+  std::atomic<int64_t> calls(0);
+  Uptime deadline = Uptime::Now() + duration;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&] {
+      int64_t previous = INT64_MIN;
+      while (Uptime::Now() < deadline) {
+        for (int i = 0; i < 1000; ++i) {
+          int64_t seen = published.load();
+          int64_t value = now();
+          if (value < previous || value < seen) failures.fetch_add(1);
+          previous = value;
+          int64_t p = published.load();
+          while (p < value && !published.compare_exchange_weak(p, value)) {
+          }
+        }
+        calls.fetch_add(1000);
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+  EXPECT_EQ(0, failures.load());
+  EXPECT_GT(calls.load(), 0);
+}
+
+}  // namespace
+
+TEST(UptimeLinux, FollowsMonotonicClock) {
+  Uptime before = Uptime::Now();
+  int64_t monotonic = MonotonicMicros();
+  Uptime after = Uptime::Now();
+  EXPECT_LE(before.inMicros(), monotonic + 1000);
+  EXPECT_GE(after.inMicros(), monotonic - 1000);
+}
+
+TEST(UptimeLinux, Advances) {
+  Uptime start = Uptime::Now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  Duration elapsed = Uptime::Now() - start;
+  EXPECT_GE(elapsed, Millis(20));
+  EXPECT_LT(elapsed, Seconds(5));
+}
+
+TEST(UptimeLinux, NowCoarse) {
+  struct timespec res;
+  ASSERT_EQ(0, clock_getres(CLOCK_MONOTONIC_COARSE, &res));
+  Duration resolution = Micros(res.tv_sec * 1000000 + res.tv_nsec / 1000);
+  // Covers truncation, delayed ticks (e.g. in VMs) and, with the TSC
+  // backend, calibration error.
+  const Duration kSlack = Millis(5);
+  Uptime previous = Uptime::NowCoarse();
+  Uptime deadline = Uptime::Now() + Millis(100);
+  while (Uptime::Now() < deadline) {
+    Uptime before = Uptime::Now();
+    Uptime coarse = Uptime::NowCoarse();
+    Uptime after = Uptime::Now();
+    // Lags by at most a couple of ticks.
+    ASSERT_LE(coarse, after + kSlack);
+    ASSERT_GE(coarse, before - resolution * 2 - kSlack);
+    // Monotone.
+    ASSERT_LE(previous, coarse);
+    previous = coarse;
+  }
+}
+
+TEST(UptimeLinux, PreciseDelay) {
+  SetDelaySpinLimit(Millis(2));
+  EXPECT_EQ(Millis(2), DelaySpinLimit());
+  std::vector<int64_t> lateness;
+  for (int i = 0; i < 50; ++i) {
+    Uptime deadline = Uptime::Now() + Micros(500 + 37 * i);
+    if (i % 2 == 0) {
+      DelayUntil(deadline);
+    } else {
+      Delay(deadline - Uptime::Now());
+    }
+    Uptime now = Uptime::Now();
+    // Never early.
+    ASSERT_GE(now, deadline);
+    lateness.push_back((now - deadline).inMicros());
+  }
+  SetDelaySpinLimit(Duration());
+  EXPECT_EQ(Duration(), DelaySpinLimit());
+  std::sort(lateness.begin(), lateness.end());
+  // Generous, for loaded machines; typically 0-1 us.
+  EXPECT_LT(lateness[lateness.size() / 2], 100);
+  EXPECT_GE(DelayOvershootEstimate(), Duration());
+}
+
+TEST(UptimeLinux, MonotoneAcrossThreads) {
+  ExpectMonotoneAcrossThreads([] { return Uptime::Now().inMicros(); },
+                              Millis(200));
+}
+
+#ifdef ROO_TIME_TSC_CLOCK_AVAILABLE
+
+TEST(TscClock, FollowsMonotonicClock) {
+  internal::TscClock clock;
+  // Covers the initial calibration, and a recalibration.
+  Uptime deadline = Uptime::Now() + Millis(1200);
+  int64_t max_error = 0;
+  while (Uptime::Now() < deadline) {
+    int64_t before = MonotonicMicros();
+    int64_t now = clock.now();
+    int64_t after = MonotonicMicros();
+    int64_t error = 0;
+    if (now < before) error = before - now;
+    if (now > after) error = now - after;
+    if (error > max_error) max_error = error;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  // Generous, for loaded machines.
+  EXPECT_LT(max_error, 5000);
+}
+
+TEST(TscClock, MonotoneAcrossThreads) {
+  internal::TscClock clock;
+  ExpectMonotoneAcrossThreads([&] { return clock.now(); }, Millis(1200));
+}
+
+#endif  // ROO_TIME_TSC_CLOCK_AVAILABLE
+
+}  // namespace roo_time
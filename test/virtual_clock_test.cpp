@@ -0,0 +1,128 @@
+#include "roo_time/virtual_clock.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "roo_time.h"
+
+namespace roo_time {
+
+namespace {
+
+// Installs an uptime source for the duration of a test.
+class ScopedUptimeSource {
+ public:
+  explicit ScopedUptimeSource(UptimeSource* source)
+      : previous_(SetUptimeSource(source)) {}
+
+  ~ScopedUptimeSource() { SetUptimeSource(previous_); }
+
+ private:
+  UptimeSource* previous_;
+};
+
+}  // namespace
+
+TEST(VirtualClock, SingleThreadDelaysAdvanceTime) {
+  Uptime real_start = Uptime::Now();
+  VirtualClock clock(Uptime::Start() + Seconds(10));
+  Uptime start;
+  {
+    ScopedUptimeSource scoped(&clock);
+    EXPECT_EQ(Uptime::Start() + Seconds(10), Uptime::Now());
+    EXPECT_EQ(Uptime::Now(), Uptime::NowCoarse());
+    start = Uptime::Now();
+    Delay(Hours(5));
+    EXPECT_EQ(start + Hours(5), Uptime::Now());
+    DelayUntil(start + Hours(7));
+    EXPECT_EQ(start + Hours(7), Uptime::Now());
+    // No-ops.
+    DelayUntil(start);
+    Delay(Seconds(-1));
+    Delay(Duration());
+    EXPECT_EQ(start + Hours(7), Uptime::Now());
+    Delay(Duration::Max());
+    EXPECT_EQ(Uptime::Max(), Uptime::Now());
+  }
+  // Back to the real clock.
+  EXPECT_LT(Uptime::Now() - real_start, Seconds(1));
+  EXPECT_EQ(nullptr, SetUptimeSource(nullptr));
+}
+
+TEST(VirtualClock, ManualAdvance) {
+  VirtualClock clock;
+  clock.advance(Millis(5));
+  EXPECT_EQ(Uptime::Start() + Millis(5), clock.now());
+  clock.advanceTo(Uptime::Start() + Millis(3));
+  EXPECT_EQ(Uptime::Start() + Millis(5), clock.now());
+  clock.advanceTo(Uptime::Start() + Millis(8));
+  EXPECT_EQ(Uptime::Start() + Millis(8), clock.now());
+  clock.advance(Millis(-1));
+  EXPECT_EQ(Uptime::Start() + Millis(8), clock.now());
+}
+
+// Threads with different periods wake up exactly at their deadlines, in
+// virtual time order, without actually waiting.
+TEST(VirtualClock, ThreadsJumpToNextDeadline) {
+  constexpr int kThreads = 3;
+  constexpr int kIterations = 1000;
+  const Duration kPeriods[kThreads] = {Millis(7), Seconds(11), Minutes(13)};
+  Uptime real_start = Uptime::Now();
+  VirtualClock clock(Uptime::Start(), kThreads);
+  ScopedUptimeSource scoped(&clock);
+  std::vector<std::thread> threads;
+  std::vector<int> late(kThreads, 0);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      Uptime deadline = Uptime::Now();
+      for (int i = 0; i < kIterations; ++i) {
+        deadline += kPeriods[t];
+        DelayUntil(deadline);
+        if (Uptime::Now() != deadline) ++late[t];
+      }
+      clock.removeParticipant();
+    });
+  }
+  for (auto& t : threads) t.join();
+  for (int t = 0; t < kThreads; ++t) EXPECT_EQ(0, late[t]) << t;
+  EXPECT_EQ(Uptime::Start() + Minutes(13) * kIterations, clock.now());
+  EXPECT_EQ(0, clock.waiting());
+  // Over 9 days of virtual time, in much less real time.
+  SetUptimeSource(nullptr);
+  EXPECT_LT(Uptime::Now() - real_start, Seconds(10));
+}
+
+// The clock only jumps once all participants are blocked.
+TEST(VirtualClock, WaitsForAllParticipants) {
+  VirtualClock clock(Uptime::Start(), 2);
+  std::thread worker([&] {
+    clock.delayUntil(Uptime::Start() + Seconds(10));
+    EXPECT_EQ(Uptime::Start() + Seconds(10), clock.now());
+    clock.removeParticipant();
+  });
+  while (clock.waiting() == 0) std::this_thread::yield();
+  // The worker waits for us.
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(Uptime::Start(), clock.now());
+  EXPECT_EQ(1, clock.waiting());
+  // Advancing explicitly is not enough to wake it up.
+  clock.advance(Seconds(5));
+  EXPECT_EQ(1, clock.waiting());
+  // Once we block too, the clock jumps to the worker's deadline, and once the
+  // worker leaves, to ours.
+  clock.delayUntil(Uptime::Start() + Seconds(20));
+  EXPECT_EQ(Uptime::Start() + Seconds(20), clock.now());
+  worker.join();
+}
+
+TEST(VirtualWallClock, FollowsVirtualClock) {
+  VirtualClock clock(Uptime::Start() + Hours(1));
+  WallTime start = DateTime(2024, 3, 31, 0, 30, 0, 0, timezone::UTC).wallTime();
+  VirtualWallClock wall_clock(clock, start);
+  EXPECT_EQ(start, wall_clock.now());
+  clock.delayUntil(clock.now() + Hours(48));
+  EXPECT_EQ(start + Hours(48), wall_clock.now());
+}
+
+}  // namespace roo_time
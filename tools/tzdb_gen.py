@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+"""Generates compiled-in time zone tables for roo_time from TZif data.
+
+Reads the binary TZif files of the system (or of the `tzdata` Python package)
+time zone database, and emits src/roo_time/tzdb/zones.h and zones.cpp, with a
+TzdbTimeZone constant per zone. Each zone is a sorted array of UTC transition
+instants (in seconds since Epoch), and the UTC offsets in effect after each
+of them.
+
+Transitions that are not listed explicitly in the TZif file (i.e. those
+implied by its POSIX TZ footer, as produced by `zic -b slim`) are recovered
+by sampling the zone via the Python `zoneinfo` module.
+
+Each zone also carries the POSIX TZ footer rule, which TzdbTimeZone evaluates
+for instants after the end of the table.
+
+Usage:
+  tools/tzdb_gen.py [--from-year 1970] [--to-year 2037] [--output-dir DIR]
+                    [ZONE ...]
+"""
+
+import argparse
+import datetime
+import os
+import struct
+import sys
+import zoneinfo
+
+DEFAULT_ZONES = [
+    "America/Chicago",
+    "America/Denver",
+    "America/Los_Angeles",
+    "America/New_York",
+    "America/Sao_Paulo",
+    "Asia/Kolkata",
+    "Asia/Shanghai",
+    "Asia/Tokyo",
+    "Australia/Sydney",
+    "Europe/Berlin",
+    "Europe/London",
+    "Europe/Warsaw",
+]
+
+HEADER_TEMPLATE = """\
+#pragma once
+
+// Generated by tools/tzdb_gen.py from tzdata {version}. DO NOT EDIT.
+//
+// Transitions cover years {from_year}-{to_year}; later instants are evaluated
+// from the POSIX TZ rules.
+
+#include "roo_time/tzdb.h"
+
+namespace roo_time {{
+namespace tzdb {{
+
+{declarations}
+
+}}  // namespace tzdb
+}}  // namespace roo_time
+"""
+
+SOURCE_TEMPLATE = """\
+// Generated by tools/tzdb_gen.py from tzdata {version}. DO NOT EDIT.
+
+#include "roo_time/tzdb/zones.h"
+
+namespace roo_time {{
+namespace tzdb {{
+
+namespace {{
+
+{tables}
+
+}}  // namespace
+
+{definitions}
+
+}}  // namespace tzdb
+
+namespace internal {{
+
+const TzdbTimeZone* const kTzdbZones[] = {{
+{zone_list}
+}};
+
+const uint16_t kTzdbZoneCount = {zone_count};
+
+}}  // namespace internal
+}}  // namespace roo_time
+"""
+
+
+def find_tzif(zone):
+    for root in zoneinfo.TZPATH:
+        path = os.path.join(root, zone)
+        if os.path.isfile(path):
+            return path
+    raise FileNotFoundError(f"TZif file for {zone} not found in "
+                            f"{zoneinfo.TZPATH}")
+
+
+def read_tzif(path):
+    """Returns (initial_offset, [(time, offset)], footer) from a TZif file.
+
+    Offsets are in seconds east of UTC. Uses the 64-bit (v2+) data block. The
+    footer is the POSIX TZ rule for instants after the last transition, or
+    None if the file has none.
+    """
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"TZif":
+        raise ValueError(f"{path} is not a TZif file")
+
+    def parse_header(block):
+        return struct.unpack(">6l", block[20:44])
+
+    isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = parse_header(data)
+    time_size = 4
+    if data[4] >= ord("2"):
+        # Skip the v1 block.
+        v1_len = (44 + timecnt * 5 + typecnt * 6 + charcnt + leapcnt * 8 +
+                  isstdcnt + isutcnt)
+        data = data[v1_len:]
+        isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = (
+            parse_header(data))
+        time_size = 8
+    pos = 44
+    fmt = ">%d%s" % (timecnt, "q" if time_size == 8 else "l")
+    times = struct.unpack(fmt, data[pos:pos + time_size * timecnt])
+    pos += time_size * timecnt
+    indices = data[pos:pos + timecnt]
+    pos += timecnt
+    types = [
+        struct.unpack(">lBB", data[pos + 6 * i:pos + 6 * i + 6])[0]
+        for i in range(typecnt)
+    ]
+    pos += (typecnt * 6 + charcnt + leapcnt * (time_size + 4) + isstdcnt +
+            isutcnt)
+    footer = None
+    if time_size == 8 and data[pos:pos + 1] == b"\n":
+        end = data.find(b"\n", pos + 1)
+        if end > pos + 1:
+            footer = data[pos + 1:end].decode("ascii")
+    # Per RFC 8536, local time before the first transition uses type 0.
+    return (types[0], [(t, types[i]) for t, i in zip(times, indices)],
+            footer)
+
+
+def sample_transitions(zone, start, end):
+    """Finds offset transitions in (start, end] by sampling and bisection."""
+    tz = zoneinfo.ZoneInfo(zone)
+
+    def offset(t):
+        dt = datetime.datetime.fromtimestamp(t, tz)
+        return int(dt.utcoffset().total_seconds())
+
+    result = []
+    step = 86400
+    t = start
+    prev = offset(t)
+    while t < end:
+        nxt = min(t + step, end)
+        cur = offset(nxt)
+        if cur != prev:
+            lo, hi = t, nxt
+            while hi - lo > 1:
+                mid = (lo + hi) // 2
+                if offset(mid) == prev:
+                    lo = mid
+                else:
+                    hi = mid
+            result.append((hi, cur))
+            prev = cur
+        t = nxt
+    return result
+
+
+def zone_transitions(zone, from_year, to_year):
+    start = int(datetime.datetime(from_year, 1, 1,
+                                  tzinfo=datetime.timezone.utc).timestamp())
+    end = int(datetime.datetime(to_year + 1, 1, 1,
+                                tzinfo=datetime.timezone.utc).timestamp())
+    end = min(end, 2**31 - 1)
+    initial, explicit, footer = read_tzif(find_tzif(zone))
+    transitions = []
+    last_time = None
+    offset = initial
+    for t, off in explicit:
+        if t <= start:
+            offset = off
+        elif t < end:
+            transitions.append((t, off))
+        last_time = t
+    if last_time is None or last_time < end:
+        # Remaining transitions are implied by the footer rule.
+        sample_from = max(start, last_time if last_time is not None else start)
+        transitions += [(t, off)
+                        for t, off in sample_transitions(zone, sample_from, end)
+                        if t > start]
+    # Drop no-op transitions (e.g. abbreviation-only changes).
+    result = []
+    current = offset
+    for t, off in transitions:
+        if off != current:
+            result.append((t, off))
+            current = off
+    # The footer applies after the last explicit transition. Unless the table
+    # includes all the explicit offset changes, it cannot take over at `end`.
+    # (Files generated with `zic -b fat` end with a no-op transition at
+    # 2**31 - 1, which does not count.)
+    last_change = None
+    previous = initial
+    for t, off in explicit:
+        if off != previous:
+            last_change = t
+            previous = off
+    if last_change is not None and last_change >= end:
+        footer = None
+    return offset, result, end, footer
+
+
+def identifier(zone):
+    return zone.replace("/", "_").replace("-", "_").replace("+", "plus")
+
+
+def to_minutes(zone, offset):
+    minutes, remainder = divmod(offset, 60)
+    if remainder != 0:
+        print(f"warning: {zone}: offset {offset}s rounded to minutes",
+              file=sys.stderr)
+    return minutes
+
+
+def format_array(ctype, name, values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line])
+                     + ",")
+    body = "\n".join(lines)
+    return f"constexpr {ctype} {name}[] = {{\n{body}\n}};"
+
+
+def tzdata_version():
+    for root in zoneinfo.TZPATH:
+        path = os.path.join(root, "tzdata.zi")
+        if os.path.isfile(path):
+            with open(path) as f:
+                first = f.readline().split()
+                if len(first) == 3 and first[1] == "version":
+                    return first[2]
+    return "unknown"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("zones", nargs="*", default=DEFAULT_ZONES)
+    parser.add_argument("--from-year", type=int, default=1970)
+    parser.add_argument("--to-year", type=int, default=2037)
+    parser.add_argument("--output-dir",
+                        default=os.path.join(os.path.dirname(__file__), "..",
+                                             "src", "roo_time", "tzdb"))
+    args = parser.parse_args()
+
+    declarations = []
+    tables = []
+    definitions = []
+    zone_list = []
+    for zone in sorted(args.zones):
+        ident = identifier(zone)
+        initial, transitions, end, footer = zone_transitions(
+            zone, args.from_year, args.to_year)
+        if footer is None:
+            print(f"warning: {zone}: no usable POSIX TZ footer; offsets after "
+                  f"{args.to_year} will repeat the last one", file=sys.stderr)
+        offsets = [to_minutes(zone, initial)]
+        offsets += [to_minutes(zone, off) for _, off in transitions]
+        declarations.append(f"/// {zone}\nextern const TzdbTimeZone {ident};")
+        if transitions:
+            tables.append(
+                format_array("int32_t", f"k{ident}Transitions",
+                             [t for t, _ in transitions], 6))
+            transitions_ref = f"k{ident}Transitions"
+        else:
+            transitions_ref = "nullptr"
+        tables.append(format_array("int16_t", f"k{ident}Offsets", offsets,
+                                   12))
+        footer_ref = f'"{footer}"' if footer is not None else "nullptr"
+        definitions.append(f"const TzdbTimeZone {ident}(\n"
+                           f'    "{zone}",\n'
+                           f"    {transitions_ref},\n"
+                           f"    k{ident}Offsets,\n"
+                           f"    {len(transitions)},\n"
+                           f"    {end},\n"
+                           f"    {footer_ref});")
+        zone_list.append(f"    &tzdb::{ident},")
+
+    version = tzdata_version()
+    header = HEADER_TEMPLATE.format(version=version,
+                                    from_year=args.from_year,
+                                    to_year=args.to_year,
+                                    declarations="\n\n".join(declarations))
+    source = SOURCE_TEMPLATE.format(version=version,
+                                    tables="\n\n".join(tables),
+                                    definitions="\n\n".join(definitions),
+                                    zone_list="\n".join(zone_list),
+                                    zone_count=len(zone_list))
+    os.makedirs(args.output_dir, exist_ok=True)
+    with open(os.path.join(args.output_dir, "zones.h"), "w") as f:
+        f.write(header)
+    with open(os.path.join(args.output_dir, "zones.cpp"), "w") as f:
+        f.write(source)
+
+
+if __name__ == "__main__":
+    main()